@@ -0,0 +1,63 @@
+/* $Id$ */
+#include "alara.h"
+#include <vector>
+
+#ifndef ARRAYPOOL_H
+#define ARRAYPOOL_H
+
+/** \brief This class is a free-list pool of arrays, indexed by their
+ *         length.
+ *
+ *  Arrays returned to the pool are kept and handed out again for the
+ *  next request of the same length, rather than being freed.  It is
+ *  used for the storage of the nodes of the chains: since only the
+ *  nodes of the current chain exist at any time and its depth is
+ *  bounded, the pool soon holds enough arrays and the building of
+ *  further chains no longer calls the general-purpose allocator.
+ *  The pool is not thread-safe.
+ */
+template <class T> class ArrayPool
+{
+protected:
+  /// The free arrays of each length.
+  std::vector< std::vector<T*> > freeArrays;
+
+public:
+  /// The destructor frees all the arrays held by the pool.
+  ~ArrayPool()
+    {
+      for (size_t len=0;len<freeArrays.size();len++)
+	for (size_t idx=0;idx<freeArrays[len].size();idx++)
+	  delete[] freeArrays[len][idx];
+    };
+
+  /// This function returns an array of the length given in the
+  /// argument, or NULL if that length is not positive.
+  T* get(int len)
+    {
+      if (len <= 0)
+	return NULL;
+      if ((size_t)len < freeArrays.size() && !freeArrays[len].empty())
+	{
+	  T* ptr = freeArrays[len].back();
+	  freeArrays[len].pop_back();
+	  return ptr;
+	}
+      T* ptr = new T[len];
+      memCheck(ptr,"ArrayPool::get(...): ptr");
+      return ptr;
+    };
+
+  /// This function returns the array given in the first argument,
+  /// whose length is given in the second, to the pool.
+  void put(T* ptr, int len)
+    {
+      if (ptr == NULL)
+	return;
+      if ((size_t)len >= freeArrays.size())
+	freeArrays.resize(len+1);
+      freeArrays[len].push_back(ptr);
+    };
+};
+
+#endif
@@ -0,0 +1,136 @@
+/* $Id$ */
+#include "alara.h"
+#include <vector>
+
+#ifdef HAVE_HDF5
+#include <hdf5.h>
+#endif
+
+#ifndef BINOUTPUT_H
+#define BINOUTPUT_H
+
+/* record tags of the native structured output format */
+#define BINOUT_MAGIC     "ALARARES"
+#define BINOUT_VERSION   2
+#define BINOUT_END       -1
+#define BINOUT_RESPONSE   1
+#define BINOUT_TABLE      2
+#define BINOUT_TOTALS     3
+
+/* component index used for the compacted (all constituents) table */
+#define BINOUT_TOTAL_COMP -1
+
+/* size of the stdio buffer used for the native format */
+#define BINOUT_BUFSIZE   (1<<20)
+
+/** \brief This class is used to write all the requested responses as
+ *         typed, indexed arrays in a structured binary file.
+ *
+ *  It mirrors the text tables written to standard output: for each
+ *  response of each output block, there is one isotope x cooling time
+ *  table for each interval/zone/mixture (and each of its constituents,
+ *  if requested), followed by a table of totals.  If ALARA was
+ *  configured with HDF5, the file is an HDF5 file.  Otherwise, it is a
+ *  stream of tagged records in the native format described in the
+ *  users' guide.  All members are static since there is at most one
+ *  such file per run.
+ */
+class BinOutput
+{
+protected:
+  /// The stdio file pointer for the native format.
+  static FILE* binOut;
+
+  /// The buffer attached to 'binOut' to minimize system calls.
+  static char* outBuffer;
+
+#ifdef HAVE_HDF5
+  /// The HDF5 file identifier.
+  static hid_t h5File;
+
+  /// The HDF5 group for the current response.
+  static hid_t h5Response;
+#endif
+
+  /// This flag indicates whether the file header, including the
+  /// cooling times, has been written.
+  static int headerDone;
+
+  /// This is the number of results (cooling times plus shutdown) in
+  /// each row of a table.
+  static int nResults;
+
+  /// This counts the responses written so far and is used to index them.
+  static int responseCtr;
+
+  /// This is the 1-based index of the interval/zone/mixture for the
+  /// next table.
+  static int entityNum;
+
+  /// This is the constituent index of the next table, or
+  /// BINOUT_TOTAL_COMP for the total of all constituents.
+  static int compNum;
+
+  /// This is the name of the interval/zone/mixture and constituent for
+  /// the next table.
+  static std::string entityName;
+
+  /// These accumulate the entity indices and total responses for the
+  /// totals table of the current response.
+  static std::vector<int> totalEntity;
+  static std::vector<double> totalResult;
+
+  /// This function writes the file header with the cooling times
+  /// given by the argument.
+  static void writeHeader(CoolingTime*);
+
+  /// Utility to write a length-prefixed string in the native format.
+  static void writeString(const char*);
+
+public:
+  /// This function opens the structured output file with the name
+  /// given in the argument.
+  static void initBinOutput(const char*);
+
+  /// Inline function indicating whether structured output was requested.
+  static int active()
+#ifdef HAVE_HDF5
+    { return (binOut != NULL || h5File >= 0); };
+#else
+    { return (binOut != NULL); };
+#endif
+
+  /// This function begins a new response: the arguments are the list
+  /// of cooling times, the resolution, the response bit, the
+  /// normalization type and the descriptive string of the response.
+  static void beginResponse(CoolingTime*,int,int,int,const char*);
+
+  /// This function sets the index, constituent and name of the
+  /// interval/zone/mixture for the next table.
+  static void setEntity(int,int,const char*,const char* compName=NULL);
+
+  /// Inline functions returning the index and constituent of the
+  /// current interval/zone/mixture, which are recorded even if no
+  /// structured output was requested.
+  static int getEntity()
+    { return entityNum; };
+  static int getComp()
+    { return compNum; };
+
+  /// This function writes one isotope x cooling time table for the
+  /// current entity: the list of kza values, the row-major array of
+  /// results and the total for each cooling time.
+  static void writeTable(std::vector<int>&,std::vector<double>&,double*);
+
+  /// This function adds the total of one interval/zone/mixture to the
+  /// table of totals of the current response.
+  static void addTotal(int,double*);
+
+  /// This function writes the table of totals for the current response.
+  static void writeTotals();
+
+  /// This function finishes and closes the file.
+  static void close();
+};
+
+#endif
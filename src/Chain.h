@@ -1,11 +1,22 @@
 /* $Id: Chain.h,v 1.14 2007-12-12 06:06:14 phruksar Exp $ */
 #include "alara.h"
+#include <vector>
+#include <sys/types.h>
 
 #ifndef CHAIN_H 
 #define CHAIN_H
 
 #define INITMAXCHAINLENGTH 25
 
+/* rank of the nodes whose subtrees are solved by worker processes, and
+ * number of nodes a root must have before they are */
+#define WORKER_RANK 2
+#define WORKER_MIN_NODES 1000
+
+/* truncation state of the records marking the start and end of the
+ * chains of a root in a topology file */
+#define TOPOLOGY_ROOT -1
+
 /** \brief This class stores the information about a particular chain as
  *         the chains are being created and solved.
  *   
@@ -40,6 +51,49 @@ protected:
   /// Flag indicating whether this is a forward or reverse calculation
   static int mode;
 
+  /// The file to which the truncation state of each new node is
+  /// recorded, or NULL.
+  static FILE* recordFile;
+
+  /// The file from which the truncation state of each new node is
+  /// replayed, or NULL.
+  /** The file is a sequence of records of two integers: the kza of
+      each node for which a reference calculation was performed and
+      the truncation bits it produced, in the order in which the nodes
+      were built.  The records of each root are preceded by one with
+      the kza of the root and followed by one with a kza of 0, both
+      with a truncation state of TOPOLOGY_ROOT. */
+  static FILE* replayFile;
+
+  /// The name of the topology file being replayed.
+  static char* replayFname;
+
+  /// The fraction of the replayed truncation states that are checked
+  /// against a new reference calculation.
+  static double verifyFraction;
+
+  /// The number of replayed truncation states that were checked, and
+  /// the number of those that differ from the new reference
+  /// calculation.
+  static int nVerified, nMismatched;
+
+  /// The maximum number of worker processes solving the subtrees of a
+  /// root at the same time.
+  static int maxWorkers;
+
+  /// The process ids of the running workers and the files to which
+  /// they write their results, in the main process.
+  /** In a worker, 'workerFile' only holds its own file. */
+  static std::vector<pid_t> workerPid;
+  static std::vector<FILE*> workerFile;
+
+  /// The rank of the node whose subtree is solved by this worker
+  /// process, or -1 in the main process.
+  static int workerRank;
+
+  /// The numbers of nodes and chains when this worker was forked.
+  static int workerNodes, workerChains;
+
   /// A counter which simply tracks the length of the current chain.
   /** By convention, it will always be 1 greater than the rank of the
       bottom isotope in the chain. */
@@ -65,6 +119,22 @@ protected:
   /// truncation calculation or a full solution.
   int solvingRef;
 
+  /// The rank of the first isotope whose matrix elements are
+  /// recalculated in a forward reference calculation.
+  /** This is normally the rank before the last, since only the most
+      recent isotope can be new, but is 0 when the reference
+      calculations of the previous nodes were skipped. */
+  int refNewRank;
+
+  /// The number of nodes counted before this chain was started.
+  int firstNode;
+
+  /// This flag indicates that the subtree of a node was handed to a
+  /// worker since the last chain was solved.
+  /** The rows of the matrices of the nodes added since then have not
+      been calculated, so newRank must not advance past them. */
+  int forked;
+
   /// If an isotope is involved in a loop, the last iteration of
   /// the loop need not be treated with loop solutions.
   /** This array tracks the beginning of the last loop iteration
@@ -79,7 +149,7 @@ protected:
       vector and the total destruction rate vector for both
       transmutation and pure decay.  These are later collapsed
       with the fluxes as required. */
-  double **rates;
+  RateType **rates;
 
   /// An array of scalar rates, calculated by collapsing the rate
   /// vectors pointed to by 'rates' with the fluxes of a given 
@@ -141,6 +211,10 @@ protected:
   /// flux for truncation calculations.
   Volume *reference;
 
+  /// The cluster of intervals whose reference flux truncates this
+  /// chain, and in which it is solved.  (see Volume::clusterRefFlux())
+  int refGroup;
+
   /// This simply indcates the current length of the various arrays
   /// and vectors.
   /** To avoid reallocating space with each change in the
@@ -154,6 +228,31 @@ protected:
   /// This function establishes the truncation state following the
   /// extension of a chain.
   void setState(topSchedule*);
+
+  /// This function performs the truncation reference calculation on
+  /// the schedule given in the first argument and returns the relative
+  /// productions.  If the second argument is TRUE, all the matrix
+  /// elements are recalculated.
+  double* solveRef(topSchedule*, int fullRef=FALSE);
+
+  /// This function returns the truncation bits for the relative
+  /// productions given in the argument.
+  int getTruncBits(double*);
+
+  /// This function reads the truncation bits of the next node from
+  /// the topology file being replayed.
+  int replayTruncBits();
+
+  /// This function decides whether the subtree of the newest node is
+  /// handed to a worker process, and forks it if so.
+  int forkSubtree();
+
+  /// This function waits for a worker process to finish and tallies
+  /// its results into those of the root.
+  void waitWorker();
+
+  /// This function writes the results of a worker process and ends it.
+  void finishWorker();
   
   /// This function performs the doubling of the rate vectors 
   /// discussed in the description of 'maxChainLength'.
@@ -186,8 +285,44 @@ public:
   /// reverse calculation mode and calls NuclearData::modeReverse().
   static void modeReverse();
 
+  /// This function restores the forward calculation mode, for the next
+  /// problem solved by the same process.
+  static void modeForward();
+
+  /// This function opens the file named in the argument to record the
+  /// truncation state of every node.
+  static void recordTopology(const char*);
+
+  /// This function opens the file named in the first argument to
+  /// replay the truncation states recorded in a previous run.
+  static void replayTopology(const char*);
+
+  /// This function sets the fraction of the replayed truncation states
+  /// that are checked against a reference calculation.
+  static void setVerify(double setFraction)
+    { verifyFraction = setFraction; };
+
+  /// These functions surround the building of the chains of the root
+  /// whose kza is given in a topology file.
+  static void beginTopology(int);
+  static void endTopology();
+
+  /// This function closes the topology files and reports the result
+  /// of the verification of a replay.
+  static void closeTopology();
+
+  /// This function sets the maximum number of worker processes.
+  static void setWorkers(int setMaxWorkers)
+    { maxWorkers = setMaxWorkers; };
+
+  /// This function disables the worker processes when the nodes must
+  /// be built in order, to write a tree or topology file.
+  static void checkWorkers();
+
   /// Default constructor 
-  Chain(Root *newRoot=NULL,topSchedule* top=NULL);
+  /** The tree of the root isotope is built from the start for the
+      reference flux cluster given in the last argument. */
+  Chain(Root *newRoot=NULL,topSchedule* top=NULL,int group=0);
 
   /// The copy constructor 
   Chain(const Chain&);
@@ -199,8 +334,9 @@ public:
   /// Overloaded assignment operator  
   Chain& operator=(const Chain&);
 
-  /// This recursive function hold the primary responsibility for
-  /// managing the growth and pruning of the tree/chains.
+  /// This function holds the primary responsibility for managing the
+  /// growth and pruning of the tree/chains, advancing to the next
+  /// chain to be solved.
   int build(topSchedule*);
 
   /// This function initializes the 'colRates' vector and sets the
@@ -209,8 +345,9 @@ public:
 
   /// This function folds the vector rates pointed to by the 'rates'
   /// vector with the fluxes contained in the VolFlux list and fills
-  /// 'colRates' with the scalar results.
-  void collapseRates(VolFlux*);
+  /// 'colRates' with the scalar results.  The flux dependent rates are
+  /// multiplied by the optional second argument.
+  void collapseRates(VolFlux*, double fluxScale=1.0);
 
   /// This function is the workhorse of the solution phase.
   void fillTMat(Matrix&, double, int);
@@ -226,6 +363,19 @@ public:
   /// second argument.
   void setDecay(Matrix& D, double time);
 
+  /// This function fills the decay matrices for all of the decay times
+  /// given in the second argument at once, sharing the exponentials
+  /// and Bateman denominators between them.  The third argument is
+  /// the number of times and matrices.
+  void setDecayAll(Matrix* D, double* time, int nTimes);
+
+  /// This function applies the decay matrices given in the second
+  /// argument to the transfer matrix given in the third, filling only
+  /// the elements of the results in the first argument that are
+  /// tallied (see topScheduleT::results(...)).  The last argument is
+  /// the number of matrices.
+  void decayAll(Matrix*, Matrix*, Matrix&, int);
+
   /// Calls interface routine of object pointed to by 'root' to get,
   /// and return, its KZA value
   int getRoot();
@@ -240,6 +390,13 @@ public:
 
   /// Inline function provides access to the 'chainLength' variable.
   int getChainLength() { return chainLength; };
+
+  /// Inline function provides access to the reference flux cluster.
+  int getRefGroup() { return refGroup; };
+
+  /// This function determines whether any interval containing the root
+  /// isotope belongs to the reference flux cluster of this chain.
+  int hasReference();
 };
 
 #endif
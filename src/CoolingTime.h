@@ -9,6 +9,10 @@
 /* cooling time head */
 #define COOL_HEAD -1
 
+/* keywords in the list of cooling times */
+#define COOL_DENSE    "dense"
+#define COOL_LOGRANGE "log_range"
+
 /** \brief This class is a linked list of the input information for 
  *         after-shutdown cooling times.
  *   
@@ -29,6 +33,27 @@ protected:
   /// This is the pointer to the next cooling time.
   CoolingTime* next;
 
+  /// Flag indicating that the decay for all of the cooling times is
+  /// evaluated at once (see Chain::setDecayAll(...)).
+  static int dense;
+
+  /// In the postprocessing of a reverse calculation, the results of all
+  /// the targets are tabulated side by side, in one block of columns
+  /// for each of these targets.  It is empty otherwise.
+  static std::vector<int> targets;
+
+  /// This function writes the name of each target over its block of
+  /// columns, if any.
+  void writeTargets();
+
+  /// This function writes the label of each column of results.
+  void writeTimes();
+
+  /// This function adds the cooling times of a log_range, read from
+  /// the stream given as an argument, after this one, and returns the
+  /// last one added.
+  CoolingTime* getLogRange(istream&);
+
 public:
   /// Default constructor
   CoolingTime(double coolTime=COOL_HEAD, char unts=' ');
@@ -64,6 +89,20 @@ public:
   /// Inline function to return the boolean result indicating whether or
   /// not this CoolingTime is the head of the list. 
   int head() { return (coolingTime == COOL_HEAD);};
+
+  /// This function counts the results of each block of columns: the
+  /// cooling times and the shutdown result.
+  int count();
+
+  /// Inline function providing read access to static member 'dense'.
+  static int isDense() { return dense; };
+
+  /// Inline function setting the targets of the blocks of columns.
+  static void setTargets(const std::vector<int>& targetList)
+    { targets = targetList; };
+
+  /// Inline function providing read access to static member 'targets'.
+  static const std::vector<int>& getTargets() { return targets; };
 };
 
 
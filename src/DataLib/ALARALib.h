@@ -109,6 +109,9 @@ DATALIB_IEAF     6     ieaf     A data library with cross-section
  binLib : FILE*
     A file pointer for the library itself.
 
+ libName : char*
+    The name of the library file, used to reopen it.
+
  
  *** Member Functions ***
 
@@ -145,6 +148,10 @@ DATALIB_IEAF     6     ieaf     A data library with cross-section
     called through the object pointed to by the second argument.  If
     no data is found, it calles NuclearData::setNoData().
 
+ void reopen()
+    This function opens the library file again, so that a forked
+    process reads it through its own file position.
+
  */
 
 #ifndef ALARALIB_H
@@ -181,6 +188,7 @@ protected:
     } *idx;
 
   FILE* binLib;
+  char* libName;
   fstream tmpIdx;
   long offset;
 
@@ -199,6 +207,7 @@ public:
   /* Chain */
   void readData(int, NuclearData*);
   void readGammaData(int, GammaSrc*);
+  void reopen();
 
   /* Write Binary Data */
   void writeHead(int,float*,float*);
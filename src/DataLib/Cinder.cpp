@@ -17,7 +17,7 @@ const double Cinder::CINDER_UPPER_HL = 1.0E+99;
 const int    Cinder::FLOAT_DIGITS    = 10;
 
 Cinder::Cinder(const LibDefine& lib) :
-  InFile(lib.Args[0].c_str()),
+  InFile(lib.Args[0]),
   FileName(lib.Args[0].c_str()), 
   LoadTransmutation(true),
   LoadDecay(true),
@@ -42,7 +42,7 @@ void Cinder::LoadLibrary() throw(Exception)
 {
   string str;
 
-  if(!InFile.is_open())
+  if(!InFile.IsOpen())
     throw ExFileOpen("Cinder::LoadLibrary() function", FileName);
 
   // This file is divided into three sections:
@@ -85,7 +85,7 @@ void Cinder::ActivationData() throw(Exception)
 
   Path path;
 
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
   while(str.find(begin_fission) == string::npos)
     {
       if(str.find(start_iso) != string::npos)
@@ -101,9 +101,9 @@ void Cinder::ActivationData() throw(Exception)
 	    DecayData(parent_kza);
 
 	  // Skip decay data
-	  getline(InFile,str,'\n');
+	  InFile.GetLine(str, '\n');
 	  while(str.find(fission_rxn) == string::npos)
-	    getline(InFile,str,'\n');
+	    InFile.GetLine(str, '\n');
 
 	  // Check for the option to not load transmutation data. If this 
 	  // option is set, do not load!
@@ -116,8 +116,7 @@ void Cinder::ActivationData() throw(Exception)
 	      // There is a non-zero fission cross-section:
 	      for(i = NumNeutronGroups-1; i >= 0; i--)
 		{
-		  InFile >> str;
-		  cs[i] = atof(str.c_str());
+		  cs[i] = InFile.ReadFloat();
 		} 
 
 	      // Set the parent fission cross-section:
@@ -130,11 +129,11 @@ void Cinder::ActivationData() throw(Exception)
 	  // Done with fission, deal with other transmutation reactions:
 	  InFile >> str;
 	  num_rxn = atoi(str.c_str());
-	  getline(InFile,str,'\n');
+	  InFile.GetLine(str, '\n');
 
 	  for(i = 0; i < num_rxn; i++)
 	    {
-	      getline(InFile,str,'\n');
+	      InFile.GetLine(str, '\n');
 	      daughter_kza = atoi(str.substr(10,7).c_str());
 	      daughter_kza = CinderToKza(daughter_kza);
 
@@ -150,8 +149,7 @@ void Cinder::ActivationData() throw(Exception)
 
 	      for(j = NumNeutronGroups-1; j >= 0; j--)
 		{
-		  InFile >> str;
-		  cs[j] = atof(str.c_str());
+		  cs[j] = InFile.ReadFloat();
 		}
 
 	      if(!total_flag) path.CrossSection = cs;	      
@@ -171,13 +169,13 @@ void Cinder::ActivationData() throw(Exception)
 	      if(!total_flag)
 		Library.AddPath(parent_kza, daughter_kza, path);
 
-	      getline(InFile,str,'\n');
+	      InFile.GetLine(str, '\n');
 	      
 	      total_flag = false;
 	    }
 	}
 
-      getline(InFile, str, '\n');
+      InFile.GetLine(str, '\n');
     }    
 }
 
@@ -186,7 +184,7 @@ Kza Cinder::ExtractActParent()
   string str;
 
   for(int i = 0; i < 6; i++)
-    InFile.get();
+    InFile.Get();
 
   InFile >> str;
   return CinderToKza(atoi(str.c_str()));
@@ -215,7 +213,7 @@ void Cinder::FissionYields()
   InFile >> str;
   num_parents = atoi(str.c_str());
   yields.assign(num_parents, 0);
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
 
   // Get the kza of all fission parents, store in parent_list:
   ExtractFissionParents(num_parents, parent_list, fission_type);
@@ -227,7 +225,7 @@ void Cinder::FissionYields()
   // Get number of daughters:
   InFile >> str;
   num_daughters = atoi(str.c_str());
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
 
   // Get the Yields, and store them:
   for(i = 0; i < num_daughters; i++)
@@ -262,7 +260,7 @@ void Cinder::ExtractFissionParents(int num, vector<Kza>& parents,
       InFile >> str;
       
       // Get Z number:
-      getline(InFile, str, '-');
+      InFile.GetLine(str, '-');
       z = atoi(str.c_str());
       
       // Get A number:
@@ -301,7 +299,7 @@ void Cinder::SkipMasses(int num)
   string str;
   for(int i = 0; i <= num/4; i++)
     {
-      getline(InFile, str, '\n');
+      InFile.GetLine(str, '\n');
     }
 }
 
@@ -315,8 +313,7 @@ vector<double> Cinder::ExtractYield(int num, Kza& daughter)
   
   for(int i = 0; i < num; i++)
     {
-      InFile >> str;
-      ret.push_back(atof(str.c_str()));
+      ret.push_back(InFile.ReadFloat());
     }
   return ret;
 }
@@ -422,7 +419,7 @@ void Cinder::GetGroupInfo()
   string str;
 
   // Skip the first line...
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
 
   // Get the number of neutron groups...
   InFile >> str >> str >> str;
@@ -438,22 +435,20 @@ void Cinder::GetGroupInfo()
   // an increasing energy structure!
 
   // Read the neutron group boundaries:
-  getline(InFile, str, '\n');
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
+  InFile.GetLine(str, '\n');
   for(i = NumNeutronGroups; i >= 0 ; i--)
     {
-      InFile >> str;
-      NeutronGroupBounds[i] = atof(str.c_str());
+      NeutronGroupBounds[i] = InFile.ReadFloat();
     }
   Library.SetGroupStruct(CINDER_NEUTRON, NeutronGroupBounds);
 
   // Read the gamma group boundaries:
-  getline(InFile, str, '\n');
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
+  InFile.GetLine(str, '\n');
   for(i = NumGammaGroups; i >= 0; i--)
     {
-      InFile >> str;
-      GammaGroupBounds[i] = atof(str.c_str());
+      GammaGroupBounds[i] = InFile.ReadFloat();
     }
   Library.SetGroupStruct(CINDER_GAMMA, GammaGroupBounds);  
 }
@@ -469,7 +464,7 @@ void Cinder::DecayData(Kza parent) throw(ExDecayMode)
   double sfbr;
   double gamma_mult;
 
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
 
   // Get the Half Life:
   half_life = atof( str.substr(18,FLOAT_DIGITS).c_str() );
@@ -484,7 +479,7 @@ void Cinder::DecayData(Kza parent) throw(ExDecayMode)
   // Add the decay constant to the library:
   Library.AddDecayConstant( parent, log(2.0)/half_life );
 
-  getline(InFile,str,'\n');
+  InFile.GetLine(str, '\n');
 
   Library.AddDecayEnergy( parent, LIGHT_PARTICLES,
 			  atof(str.substr(6,FLOAT_DIGITS).c_str())*1e6 );
@@ -509,11 +504,11 @@ void Cinder::DecayData(Kza parent) throw(ExDecayMode)
   num_decay_paths = atoi(str.c_str());
 
   // Get rid of the rest of the line
-  getline(InFile, str, '\n');
+  InFile.GetLine(str, '\n');
 
   for(i = 0; i < num_decay_paths; i++)
     {
-      getline(InFile,str,'\n');
+      InFile.GetLine(str, '\n');
 
       // Get the branching ratio:
       branch = atof( str.substr(8,FLOAT_DIGITS).c_str() );
@@ -534,8 +529,8 @@ void Cinder::DecayData(Kza parent) throw(ExDecayMode)
     }
 
   // Load gamma spectrum:
-  getline(InFile,str,'\n');
-  getline(InFile,str,'\n');
+  InFile.GetLine(str, '\n');
+  InFile.GetLine(str, '\n');
 
   if( (gamma_mult = atof( str.substr(51,FLOAT_DIGITS).c_str() )) )
     {
@@ -543,8 +538,7 @@ void Cinder::DecayData(Kza parent) throw(ExDecayMode)
 
       for(i = 0; i < NumGammaGroups; i++)
 	{
-	  InFile >> str;
-	  spec.GroupWise.push_back( atof(str.c_str()) );
+	  spec.GroupWise.push_back( InFile.ReadFloat() );
 	}
 
       Library.AddSpectrum(parent, GAMMA, spec); 
@@ -1,7 +1,6 @@
 #ifndef CINDER_H
 #define CINDER_H
 
-#include <fstream>
 #include <vector>
 #include <iostream>
 #include <string>
@@ -9,6 +8,7 @@
 #include "FeindNs.h"
 #include "ExInclude.h"
 #include "Parser.h"
+#include "TextFile.h"
 
 /// The FEIND parser for CINDER format files
 /** The Cinder format contains fission yields, cross-sections and decay data.
@@ -35,7 +35,7 @@ class FEIND::Cinder : public Parser
   
  private:
   /// The input file stream
-  std::ifstream InFile;
+  TextFile InFile;
 
   /// The name of the data file
   std::string FileName;
@@ -18,6 +18,7 @@ class DecayEndf6;
 class Eaf41;
 class Cinder;
 class EndfIeaf;
+class TextFile;
 
 class Exception;
 class ExFormat;
@@ -48,6 +48,7 @@
 #define EAF2ALARA 301
 #define IEAF2ALARA 601
 #define ALARA2ADJ 104
+#define FEIND2ALARA 701
 
 #include "NuclearData.h"
 #include "GammaSrc.h"
@@ -76,11 +77,11 @@ protected:
       isotopes has N top-level entries. */
   int nParents;
 
+public:
   /// This function converts a text string argument into an integer
   /// library type as described in the catalogue above.
   static int convertLibType(char*);
 
-public:
   /// Although not formally a constructor, this function acts as one.
   static DataLib* newLib(char*,istream&);
 
@@ -109,6 +110,11 @@ public:
   // NEED COMMENT
   virtual void readGammaData(int, GammaSrc*);
 
+  /// This function gives this process its own access to the library
+  /// files, so that it does not share file positions with the process
+  /// it was forked from.  The default does nothing.
+  virtual void reopen() {};
+
 };
 
 
@@ -11,155 +11,155 @@ using namespace FEIND;
 using namespace std;
 
 DecayEndf6::DecayEndf6(const LibDefine& lib) :
-  InFile(lib.Args[0].c_str()),
+  InFile(lib.Args[0]),
   FileName(lib.Args[0].c_str())
 {
 }
 
 void DecayEndf6::LoadLibrary() throw(ExFileOpen, ExDecayMode)
 {
-  unsigned int num_spec;
+  vector<int> first_line;
+  vector<DecaySection> sections;
+  int i;
+  int num_sections;
 
-  if(!InFile.is_open())
+  if(!InFile.IsOpen())
     throw ExFileOpen("DecayEndf6::LoadLibrary() function", FileName);
 
-  Kza parent_kza;
+  InFile.IndexLines();
 
-  Parent parent;
+  // Decay data only exists on lines ending with 8457, and each run of these
+  // lines is the decay data section of one material:
+  for(i = 0; i < InFile.NumLines(); i++)
+    if(Is8457(i) && (i == 0 || !Is8457(i-1)))
+      first_line.push_back(i);
 
-  string str;
+  num_sections = first_line.size();
+  sections.resize(num_sections);
 
-  while(getline(InFile, str, '\n'))
-    {
-      // Decay data only exists on lines ending with 8457:
-      if(!Is8457(str)) continue;
+  // The sections are independent, and are decoded in parallel:
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,16)
+#endif
+  for(i = 0; i < num_sections; i++)
+    ExtractSection(first_line[i], sections[i]);
 
-      // First line in section contains the parent:
-      parent_kza = ExtractParent(str);
+  // They are added to the library in order:
+  for(i = 0; i < num_sections; i++)
+    AddSection(sections[i]);
+}
 
-      // First line also contains the number of decay spectra:
-      num_spec = atoi(str.substr(55,11).c_str());
+void DecayEndf6::ExtractSection(int line, DecaySection& sec) const
+{
+  unsigned int num_spec;
 
-      // Second line contains half life:
-      getline(InFile, str, '\n');
-      Library.AddDecayConstant(parent_kza, ExtractDecayConst(str));
+  // First line in section contains the parent:
+  sec.Parent = ExtractParent(line);
 
-      // Get the Decay Energies, and add them to the library:
-      ExtractEnergies(parent_kza, str);
+  // First line also contains the number of decay spectra:
+  num_spec = InFile.Int(line,55,11);
 
-      // Get the information for each decay daughter:
-      ExtractDecayModes(parent_kza);
+  // Second line contains half life:
+  sec.DecayConst = ExtractDecayConst(line+1);
 
-      ExtractSpectrum(num_spec, parent_kza);
-      
-      while(Is8457(str))
-	getline(InFile, str, '\n');
-    }
-}
+  // Get the Decay Energies:
+  ExtractEnergies(line+2, sec);
 
-bool DecayEndf6::Is8457(const string& str)
-{
-  // Make sure to check that the string is long enough:
-  if(str.size() == 80 && str.substr(71,4) == "8457") 
-    return true;
+  // Get the information for each decay daughter:
+  line += 3;
+  ExtractDecayModes(line, sec);
 
-  return false;
+  ExtractSpectrum(num_spec, line, sec);
 }
 
-double DecayEndf6::FormatFloat(string str)
+void DecayEndf6::AddSection(const DecaySection& sec) throw(ExDecayMode)
 {
-  if( (str.find('+') != string::npos || str.find('-') != string::npos) &&
-      (str.find('e') == string::npos && str.find('E') == string::npos) )
-    {
-      // There is a + or - present, and no E, so put one in:
-      size_t loc;
+  unsigned int i;
+
+  Library.AddDecayConstant(sec.Parent, sec.DecayConst);
 
-      if((loc = str.find('+')) == string::npos)
-        loc = str.find('-');
+  // Order of decay energies is: 
+  // Light Particles (any electrons), 
+  // Electromagnetic Radiation (any photons that leave nucleus)
+  // Heavy Particles (alphas, i think)
+  Library.AddDecayEnergy(sec.Parent, LIGHT_PARTICLES, sec.Energies[0]);
+  Library.AddDecayEnergy(sec.Parent, EM_RADIATION, sec.Energies[1]);
+  Library.AddDecayEnergy(sec.Parent, HEAVY_PARTICLES, sec.Energies[2]);
 
-      str.insert(loc,"E");
+  for(i = 0; i < sec.Modes.size(); i++)
+    {
+      try{
+	Library.AddDecayMode(sec.Parent, sec.Modes[i], sec.DIsos[i],
+			     sec.Branches[i]);
+      } catch (ExDecayMode& ex){ 
+	throw; 
+      }
     }
 
-  return atof(str.c_str());
+  for(i = 0; i < sec.Spectra.size(); i++)
+    Library.AddSpectrum(sec.Parent, sec.Spectra[i].first, 
+			sec.Spectra[i].second);
 }
 
-Kza DecayEndf6::ExtractParent(const std::string& str)
+bool DecayEndf6::Is8457(int line) const
 {
-  return Kza( FormatFloat(str.substr(0,11)) * 10 + 
-	      FormatFloat(str.substr(33,11)) );
-
+  // Make sure to check that the line is long enough:
+  return InFile.LineLength(line) == 80 && InFile.Match(line,71,"8457");
 }
 
-double DecayEndf6::ExtractDecayConst(const std::string& str)
+double DecayEndf6::FormatFloat(const string& str)
 {
-  // Get the half life, the convert to decay constant:
-  return log(2.0)/FormatFloat(str.substr(0,11));
+  // The ENDF exponent without an 'E' is handled by the TextFile parser:
+  return TextFile::EndfFloat(str.data(), str.size());
 }
 
-void DecayEndf6::ExtractEnergies(Kza parent, string& str)
+Kza DecayEndf6::ExtractParent(int line) const
 {
-  map<int, double> ret;
+  return Kza( InFile.Float(line,0,11) * 10 + 
+	      InFile.Float(line,33,11) );
 
-  // NOTE: Normally we would use str to find the number of decay energies
-  //       either 3 or 17. But from examining the data it appears that ALL
-  //       of the decay entries have only 3 decay energies.
-  //       Because of this we'll just skip this line and get the 3 energies.
-  getline(InFile, str, '\n');
-  
-  // Order of decay energies is: 
-  // Light Particles (any electrons), 
-  // Electromagnetic Radiation (any photons that leave nucleus)
-  // Heavy Particles (alphas, i think)
-  Library.AddDecayEnergy(parent, LIGHT_PARTICLES, 
-			 FormatFloat(str.substr(0,11)));
+}
 
-  Library.AddDecayEnergy(parent, EM_RADIATION, 
-			 FormatFloat(str.substr(22,11)));
+double DecayEndf6::ExtractDecayConst(int line) const
+{
+  // Get the half life, the convert to decay constant:
+  return log(2.0)/InFile.Float(line,0,11);
+}
 
-  Library.AddDecayEnergy(parent, HEAVY_PARTICLES, 
-			 FormatFloat(str.substr(44,11)));
+void DecayEndf6::ExtractEnergies(int line, DecaySection& sec) const
+{
+  // NOTE: Normally we would use the previous line to find the number of
+  //       decay energies either 3 or 17. But from examining the data it 
+  //       appears that ALL of the decay entries have only 3 decay energies.
+  //       Because of this we'll just get the 3 energies from this line.
+  sec.Energies[0] = InFile.Float(line,0,11);
+  sec.Energies[1] = InFile.Float(line,22,11);
+  sec.Energies[2] = InFile.Float(line,44,11);
 }
 
-void DecayEndf6::ExtractDecayModes(Kza parent) throw(ExDecayMode)
+void DecayEndf6::ExtractDecayModes(int& line, DecaySection& sec) const
 {
-  string str;
   int num_modes;
   int i;
-  DecayModeType decay_mode;
-
-  double branching_ratio;
 
-  getline(InFile, str, '\n');
-  num_modes = atoi(str.substr(55,11).c_str());
+  num_modes = InFile.Int(line++,55,11);
 
-  for(i = 0; i < num_modes; i++)
+  for(i = 0; i < num_modes; i++, line++)
     {
-      getline(InFile, str, '\n');
-      
-      decay_mode = ModeEtoF(FormatFloat(str.substr(0,11)));
-
-      branching_ratio = FormatFloat(str.substr(44,11));
-
-      try{
-	Library.AddDecayMode(parent, decay_mode,
-			     int(FormatFloat(str.substr(11,11))),
-			     branching_ratio);
-      } catch (ExDecayMode& ex){ 
-	throw; 
-      }
-      
+      sec.Modes.push_back(ModeEtoF(InFile.Float(line,0,11)));
+      sec.DIsos.push_back(int(InFile.Float(line,11,11)));
+      sec.Branches.push_back(InFile.Float(line,44,11));
     }
 }
 
-void DecayEndf6::ExtractSpectrum(unsigned int num, Kza parent)
+void DecayEndf6::ExtractSpectrum(unsigned int num, int& line, 
+				 DecaySection& sec) const
 {
   unsigned int i;
   int k;
-  string str;
   int spec_type;
   unsigned int num_disc;
   double disc_rel;
-  double cont_rel;
 
   double energy;
   double intensity;
@@ -175,29 +175,24 @@ void DecayEndf6::ExtractSpectrum(unsigned int num, Kza parent)
   for(i = 0; i < num; i++)
     {
       // Read the spectrum header, which consists of two lines:
-      getline(InFile, str, '\n');
-      spec_type = int(FormatFloat(str.substr(11,11)));
-      disc_cont = atoi(str.substr(22,11).c_str());
-      num_disc = atoi(str.substr(55,11).c_str());
+      spec_type = int(InFile.Float(line,11,11));
+      disc_cont = InFile.Int(line,22,11);
+      num_disc = InFile.Int(line++,55,11);
 
-      getline(InFile, str, '\n');
-      disc_rel = FormatFloat(str.substr(0,11));
-      cont_rel = FormatFloat(str.substr(44,11));
+      disc_rel = InFile.Float(line++,0,11);
 
       // We now have enough information to begin reading discrete spectrum:
       for(unsigned int j = 0; j < num_disc; j++)
 	{
 	  // Read information about the energy:
-	  getline(InFile, str, '\n');
-	  energy = FormatFloat(str.substr(0,11));
-	  line_parm = atoi(str.substr(44,11).c_str());
+	  energy = InFile.Float(line,0,11);
+	  line_parm = InFile.Int(line++,44,11);
 	     
 	  // Read information about the intensity:
-	  getline(InFile, str, '\n');
-	  intensity = FormatFloat(str.substr(22,11));
+	  intensity = InFile.Float(line++,22,11);
 
 	  // Check for unecessary information:
-	  if(line_parm > 6) getline(InFile, str, '\n');
+	  if(line_parm > 6) line++;
 	  
 	  // Now add the spectrum entry, but check to make sure its not zero:
 	  if( (intensity = intensity*disc_rel) )
@@ -212,21 +207,17 @@ void DecayEndf6::ExtractSpectrum(unsigned int num, Kza parent)
       if(disc_cont == 1 || disc_cont == 2)
 	{
 	  ContSpec cont;
-	  vector<int> last_point;
-	  vector<int> int_method;
 	  vector<pair<double, double> > region_info;
 	  vector<pair<double, double> > energy_info;
 
 	  // Read continuum header:
-	  getline(InFile, str, '\n');
-	  num_points = atoi(str.substr(55,11).c_str());
-	  num_regions = atoi(str.substr(44,11).c_str());
-	  cov_flag = atoi(str.substr(33,11).c_str());
+	  num_points = InFile.Int(line,55,11);
+	  num_regions = InFile.Int(line,44,11);
+	  cov_flag = InFile.Int(line++,33,11);
 
-	  //region_info.push_back(pair<double,double>(0,0));
-	  region_info = ExtractPairs(num_regions);
+	  region_info = ExtractPairs(num_regions, line);
 	  region_info.insert(region_info.begin(),pair<double,double>(0,0));
-	  energy_info = ExtractPairs(num_points);
+	  energy_info = ExtractPairs(num_points, line);
 
 	  for(int j = 0; j < num_regions; j++)
 	    {
@@ -245,14 +236,14 @@ void DecayEndf6::ExtractSpectrum(unsigned int num, Kza parent)
 	  if(cov_flag)
 	    {
 	      // Now, just skip covariance data:
-	      getline(InFile, str, '\n');
-	      num_points = atoi(str.substr(55,11).c_str());
+	      num_points = InFile.Int(line++,55,11);
 
-	      for(int j = 0; j < num_points; j += 3) getline(InFile, str, '\n');
+	      for(int j = 0; j < num_points; j += 3) line++;
 	    }
 	}
 
-      Library.AddSpectrum(parent, SpectrumEtoF(spec_type), spectrum);
+      sec.Spectra.push_back(pair<int,Spectrum>(SpectrumEtoF(spec_type), 
+					       spectrum));
       
       spectrum.Continuous.clear();
       spectrum.Discrete.clear();
@@ -260,7 +251,7 @@ void DecayEndf6::ExtractSpectrum(unsigned int num, Kza parent)
     }
 }
 
-DecayModeType DecayEndf6::ModeEtoF(double endf)
+DecayModeType DecayEndf6::ModeEtoF(double endf) const
 {
   if ( endf == 0 )
     return GAMMA_DECAY;
@@ -292,30 +283,28 @@ DecayModeType DecayEndf6::ModeEtoF(double endf)
   return UNKNOWN;
 }
 
-vector< pair<double, double> > DecayEndf6::ExtractPairs(int num)
+vector< pair<double, double> > DecayEndf6::ExtractPairs(int num, 
+							int& line) const
 {
   vector< pair<double, double> > ret;
   double first;
   double second;
 
-  string str;
   int i;
   int j;
   int get;
 
-  for(i = 0; i < num; i += 3)
+  for(i = 0; i < num; i += 3, line++)
     {
       // Find out the number of points we should get on this line:
       get = num - i;
       if( get > 3) get = 3;
 
-      getline(InFile, str, '\n');
-      
       for(j = 0; j < get; j++)
 	{
-	  // Extract the numbers from the string:
-	  first = FormatFloat(str.substr(j*22,11));
-	  second = FormatFloat(str.substr(j*22+11,11));
+	  // Extract the numbers from the line:
+	  first = InFile.Float(line,j*22,11);
+	  second = InFile.Float(line,j*22+11,11);
 
 	  // Add the numbers to our return list:
 	  ret.push_back(pair<double,double>(first, second));
@@ -325,7 +314,7 @@ vector< pair<double, double> > DecayEndf6::ExtractPairs(int num)
   return ret;
 }
 
-int DecayEndf6::SpectrumEtoF(double endf)
+int DecayEndf6::SpectrumEtoF(double endf) const
 {
   if(endf == 0)      return GAMMA;
   else if(endf == 1) return BETA;
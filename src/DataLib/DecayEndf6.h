@@ -2,7 +2,6 @@
 #define DECAYENDF6_H
 
 #include <string>
-#include <fstream>
 #include <map>
 #include <vector>
 #include <utility>
@@ -11,29 +10,50 @@
 #include "Parent.h"
 #include "ExInclude.h"
 #include "Parser.h"
+#include "TextFile.h"
 
 /// Parser for loading decay data from ENDF-VI files
+/** The file is read through a TextFile. The decay data sections (MF=8,
+ *  MT=457) of all materials are first decoded into DecaySection records, in
+ *  parallel when FEIND is built with OpenMP, and then added to the RamLib in
+ *  the order in which they appear in the file.
+ */
 class FEIND::DecayEndf6 : public Parser
 {
  public:
   DecayEndf6(const LibDefine& lib);
   virtual void LoadLibrary() throw(ExFileOpen, ExDecayMode);
 
-  static double FormatFloat(std::string str);
+  static double FormatFloat(const std::string& str);
 
  private:
-  std::ifstream InFile;
+  /// The decay data of a single material
+  struct DecaySection
+  {
+    Kza Parent;
+    double DecayConst;
+    double Energies[3];
+    std::vector<DecayModeType> Modes;
+    std::vector<int> DIsos;
+    std::vector<double> Branches;
+    std::vector< std::pair<int, Spectrum> > Spectra;
+  };
+
+  TextFile InFile;
   std::string FileName;
 
-  Kza ExtractParent(const std::string& str);
-  double ExtractDecayConst(const std::string& str);
-  void ExtractEnergies(Kza parent, std::string& str);
-  void ExtractDecayModes(Kza parent) throw(ExDecayMode);
-  void ExtractSpectrum(unsigned int num, Kza parent);
-  std::vector< std::pair<double, double> > ExtractPairs(int num);
-  bool Is8457(const std::string& str);
-  DecayModeType ModeEtoF(double endf);
-  int SpectrumEtoF(double endf);
+  void ExtractSection(int line, DecaySection& sec) const;
+  void AddSection(const DecaySection& sec) throw(ExDecayMode);
+  Kza ExtractParent(int line) const;
+  double ExtractDecayConst(int line) const;
+  void ExtractEnergies(int line, DecaySection& sec) const;
+  void ExtractDecayModes(int& line, DecaySection& sec) const;
+  void ExtractSpectrum(unsigned int num, int& line, DecaySection& sec) const;
+  std::vector< std::pair<double, double> > ExtractPairs(int num, 
+							int& line) const;
+  bool Is8457(int line) const;
+  DecayModeType ModeEtoF(double endf) const;
+  int SpectrumEtoF(double endf) const;
 };
 
 #endif
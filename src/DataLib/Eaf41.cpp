@@ -15,7 +15,7 @@ const int Eaf41::NumGroups = 175;
 
 Eaf41::Eaf41(const LibDefine& lib) :
   FileName(lib.Args[0].c_str()),
-  InFile(lib.Args[0].c_str())
+  InFile(lib.Args[0])
 {
   Cpt.push_back(PROTON);
   Cpt.push_back(DEUTERON);
@@ -39,13 +39,13 @@ void Eaf41::LoadLibrary() throw(ExFileOpen, ExEmptyXSec)
   
   Path path;
 
-  if(!InFile.is_open())
+  if(!InFile.IsOpen())
     throw ExFileOpen("Eaf41::LoadLibrary() function", FileName);
 
   SkipHeader();
 
-  getline(InFile, str, '\n');
-  while(!InFile.eof())
+  InFile.GetLine(str, '\n');
+  while(!InFile.Eof())
     {
       is_fission = false;
 
@@ -73,8 +73,8 @@ void Eaf41::LoadLibrary() throw(ExFileOpen, ExEmptyXSec)
 	}
 
       // Skip 2 lines:
-      getline(InFile,str,'\n');
-      getline(InFile,str,'\n');
+      InFile.GetLine(str, '\n');
+      InFile.GetLine(str, '\n');
 
       path.CrossSection.Reset(NumGroups);
 
@@ -82,8 +82,7 @@ void Eaf41::LoadLibrary() throw(ExFileOpen, ExEmptyXSec)
 	{
 	  if(i < non_zero)
 	    {
-	      InFile >> str;
-	      path.CrossSection[i] = atof(str.c_str());
+	      path.CrossSection[i] = InFile.ReadFloat();
 	    }
 	  else
 	    {
@@ -114,8 +113,8 @@ void Eaf41::LoadLibrary() throw(ExFileOpen, ExEmptyXSec)
       Library.SetPCs(parent_kza, TOTAL_CS, path.CrossSection, true);      
       
       // Get the header for this reaction:
-      getline(InFile, str, '\n');
-      if(str == "") getline(InFile, str, '\n');
+      InFile.GetLine(str, '\n');
+      if(str == "") InFile.GetLine(str, '\n');
     }
 }
 
@@ -124,7 +123,7 @@ void Eaf41::SkipHeader()
   string str;
 
   while(str[0] != '#')
-    getline(InFile, str, '\n');
+    InFile.GetLine(str, '\n');
 }
 
 Path Eaf41::ConvertPath(const string& str)
@@ -2,12 +2,12 @@
 #define EAF41_H
 
 #include <string>
-#include <fstream>
 
 #include "FeindNs.h"
 #include "Parent.h"
 #include "ExInclude.h"
 #include "Parser.h"
+#include "TextFile.h"
 
 /// The parser for the EAF 4.1 data format
 /** This library simply contains transmutation cross-sections, including some
@@ -32,7 +32,7 @@ class FEIND::Eaf41 : public Parser
   std::string FileName;
 
   /// A file stream associated with the data file
-  std::ifstream InFile;
+  TextFile InFile;
 
   /// The number of energy groups
   /** As far as I know, Eaf 4.1 files all use the 175 group VITAMIN-J structure
@@ -3,7 +3,6 @@
 #include <cstdlib>
 
 #include "RamLib.h"
-#include "DecayEndf6.h"
 #include "EndfIeaf.h"
 #include "LibDefine.h"
 
@@ -11,64 +10,64 @@ using namespace std;
 using namespace FEIND;
 
 EndfIeaf::EndfIeaf(const LibDefine& lib) :
-  InFile(lib.Args[0].c_str()),
+  InFile(lib.Args[0]),
   FileName(lib.Args[0].c_str())
 {  
 }
 
 void EndfIeaf::LoadLibrary() throw(ExFileOpen, ExEmptyXSec)
 {
-  string str;
   Kza parent_kza;
   Kza daughter_kza;
   int num_groups;
+  int line;
 
-  if(!InFile.is_open())
+  if(!InFile.IsOpen())
     throw ExFileOpen("EndfIeaf::LoadLibrary() function", FileName);
 
-  while(getline(InFile,str,'\n'))
+  InFile.IndexLines();
+
+  line = 0;
+  while(line < InFile.NumLines())
     {
-      if(!Is35(str))
-	continue;
+      if(!Is35(line))
+	{
+	  line++;
+	  continue;
+	}
       
-      parent_kza = int(DecayEndf6::FormatFloat(str.substr(0,11)));
-      daughter_kza = int(DecayEndf6::FormatFloat(str.substr(11,11)));
+      parent_kza = int(InFile.Float(line,0,11));
+      daughter_kza = int(InFile.Float(line,11,11));
 
-      num_groups = atoi(str.substr(55,11).c_str());
+      num_groups = InFile.Int(line++,55,11);
 
-      ExtractCs(parent_kza, daughter_kza, num_groups);
+      ExtractCs(parent_kza, daughter_kza, num_groups, line);
     }
 }
 
-bool EndfIeaf::Is35(const string& str)
+bool EndfIeaf::Is35(int line)
 {
-  // Make sure the string is long enough:
-  if(str.size() < 75)
+  // Make sure the line is long enough:
+  if(InFile.LineLength(line) < 75)
     return false;
 
-  if(str.substr(71,4) == "3  5")
-    return true;
-  return false;
+  return InFile.Match(line,71,"3  5");
 }
 
-void EndfIeaf::ExtractCs(Kza parent, Kza daughter, int num) throw(ExEmptyXSec)
+void EndfIeaf::ExtractCs(Kza parent, Kza daughter, int num, int& line) 
+  throw(ExEmptyXSec)
 {
   XSec cs(num);
-  string str;
   int first_group;
 
   // Get the number and cross-section of the first group:
-  getline(InFile,str,'\n');
-  first_group = atoi(str.substr(55,11).c_str());
-  getline(InFile,str,'\n');
-  cs[first_group-1] = DecayEndf6::FormatFloat(str.substr(11,11));
-
+  first_group = InFile.Int(line++,55,11);
+  cs[first_group-1] = InFile.Float(line++,11,11);
 
   for(int i = first_group; i < num; i++)
     {
-      getline(InFile,str,'\n');
-      getline(InFile,str,'\n');
-      cs[i] = DecayEndf6::FormatFloat(str.substr(11,11));
+      line++;
+      cs[i] = InFile.Float(line++,11,11);
     }
 
   // Add the data to the library:
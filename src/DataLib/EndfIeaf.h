@@ -3,13 +3,15 @@
 
 #include <vector>
 #include <string>
-#include <fstream>
 
 #include "FeindNs.h"
 #include "Parser.h"
 #include "Exception.h"
+#include "TextFile.h"
 
 /// Parser for loading cross-sections from ENDF-VI files
+/** The file is read through the index of lines of a TextFile.
+ */
 class FEIND::EndfIeaf : public Parser
 {
  public:
@@ -17,11 +19,12 @@ class FEIND::EndfIeaf : public Parser
   virtual void LoadLibrary() throw(ExFileOpen, ExEmptyXSec);
 
  private:
-  std::ifstream InFile;
+  TextFile InFile;
   std::string FileName;
 
-  bool Is35(const std::string& str);
-  void ExtractCs(Kza parent, Kza daughter, int num) throw(ExEmptyXSec);
+  bool Is35(int line);
+  void ExtractCs(Kza parent, Kza daughter, int num, int& line) 
+    throw(ExEmptyXSec);
 };
 
 #endif
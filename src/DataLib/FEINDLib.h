@@ -6,6 +6,7 @@
 #include "DataLib.h"
 #include "FEIND.h"
 #include <vector>
+#include <map>
 
 using namespace std;
 
@@ -15,6 +16,7 @@ class FEINDLib : public DataLib
 { 
  public:
   FEINDLib(char* arg0,char* arg1,char* arg2, int setType=DATALIB_FEIND);
+  FEINDLib(char* arg0,char* arg1,char* arg2, const char* alaraFname);
 
   void readData(int, NuclearData*);
   void readGammaData(int, GammaSrc*);
@@ -23,6 +25,20 @@ class FEINDLib : public DataLib
   FissionType fissionType;
   void initFissionType(char* arg2);
 
+  /* the frozen library: one record per parent, see freeze() */
+  vector<char> frozen;
+  map<int,long> frozenIdx;
+
+  /* pointers into the current record, passed to NuclearData::setData */
+  vector<float*> rxnXSect;
+  vector<char*> rxnEmitted;
+
+  void load(char*,char*,char*);
+  void getData(int, int&, float&, float*, int*&, char**&, float**&, float*&);
+  void deleteData(int, int*, char**, float**, float*);
+  void freeze();
+  void makeBinLib(const char*);
+
 };
 
 #endif
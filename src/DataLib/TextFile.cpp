@@ -0,0 +1,353 @@
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "TextFile.h"
+
+using namespace std;
+using namespace FEIND;
+
+TextFile::TextFile(const string& fileName) :
+  FileName(fileName),
+  Data(NULL),
+  Size(0),
+  Mapped(false),
+  Open(false),
+  Pos(0),
+  AtEof(false)
+{
+  struct stat stat_info;
+  int fd = open(FileName.c_str(), O_RDONLY);
+
+  if(fd < 0) return;
+
+  // Regular files are mapped into memory:
+  if(fstat(fd, &stat_info) == 0 && S_ISREG(stat_info.st_mode) &&
+     stat_info.st_size > 0)
+    {
+      void* map_data = mmap(NULL, stat_info.st_size, PROT_READ, MAP_PRIVATE,
+			    fd, 0);
+      if(map_data != MAP_FAILED)
+	{
+	  Data = (const char*)map_data;
+	  Size = stat_info.st_size;
+	  Mapped = true;
+	}
+    }
+  close(fd);
+
+  // Anything else (empty files, pipes...) is read into memory:
+  if(!Mapped)
+    {
+      ifstream in_file(FileName.c_str());
+      stringstream ss;
+
+      if(!in_file.is_open()) return;
+
+      ss << in_file.rdbuf();
+      Contents = ss.str();
+      Data = Contents.data();
+      Size = Contents.size();
+    }
+
+  Open = true;
+}
+
+TextFile::~TextFile()
+{
+  if(Mapped) munmap((void*)Data, Size);
+}
+
+bool TextFile::GetLine(string& str, char delim)
+{
+  const char* found;
+
+  str.clear();
+
+  if(Pos >= Size)
+    {
+      AtEof = true;
+      return false;
+    }
+
+  found = (const char*)memchr(Data + Pos, delim, Size - Pos);
+
+  if(found)
+    {
+      str.assign(Data + Pos, found - (Data + Pos));
+      Pos = found - Data + 1;
+    }
+  else
+    {
+      // The last line has no delimiter:
+      str.assign(Data + Pos, Size - Pos);
+      Pos = Size;
+      AtEof = true;
+    }
+
+  return true;
+}
+
+TextFile& TextFile::operator>>(string& str)
+{
+  size_t start;
+
+  str.clear();
+
+  while(Pos < Size && isspace((unsigned char)Data[Pos])) Pos++;
+
+  start = Pos;
+  while(Pos < Size && !isspace((unsigned char)Data[Pos])) Pos++;
+
+  if(Pos >= Size) AtEof = true;
+
+  str.assign(Data + start, Pos - start);
+
+  return *this;
+}
+
+double TextFile::ReadFloat()
+{
+  size_t start;
+
+  while(Pos < Size && isspace((unsigned char)Data[Pos])) Pos++;
+
+  start = Pos;
+  while(Pos < Size && !isspace((unsigned char)Data[Pos])) Pos++;
+
+  if(Pos >= Size) AtEof = true;
+
+  return ToFloat(Data + start, Pos - start);
+}
+
+int TextFile::Get()
+{
+  if(Pos >= Size)
+    {
+      AtEof = true;
+      return EOF;
+    }
+
+  return (unsigned char)Data[Pos++];
+}
+
+void TextFile::IndexLines()
+{
+  size_t pos = 0;
+  const char* found;
+
+  LineStart.clear();
+
+  while(pos < Size)
+    {
+      LineStart.push_back(pos);
+
+      found = (const char*)memchr(Data + pos, '\n', Size - pos);
+      pos = found ? found - Data + 1 : Size;
+    }
+}
+
+int TextFile::LineLength(int line) const
+{
+  size_t end;
+  int len;
+
+  if(line < 0 || line >= NumLines()) return 0;
+
+  end = (line + 1 < NumLines()) ? LineStart[line+1] : Size;
+  len = end - LineStart[line];
+
+  // Don't count the newline character:
+  if(len > 0 && Data[LineStart[line] + len - 1] == '\n') len--;
+
+  return len;
+}
+
+int TextFile::Field(int line, int col, int width, const char*& str) const
+{
+  int len = LineLength(line);
+
+  str = NULL;
+  if(col >= len) return 0;
+
+  str = Data + LineStart[line] + col;
+  return (len - col < width) ? len - col : width;
+}
+
+bool TextFile::Match(int line, int col, const char* tag) const
+{
+  const char* str;
+  int tag_len = strlen(tag);
+
+  if(Field(line, col, tag_len, str) != tag_len) return false;
+
+  return strncmp(str, tag, tag_len) == 0;
+}
+
+double TextFile::Float(int line, int col, int width) const
+{
+  const char* str;
+  int len = Field(line, col, width, str);
+
+  return EndfFloat(str, len);
+}
+
+int TextFile::Int(int line, int col, int width) const
+{
+  const char* str;
+  int len = Field(line, col, width, str);
+
+  return ToInt(str, len);
+}
+
+double TextFile::ToFloat(const char* str, int len)
+{
+  return ParseFloat(str, len, false);
+}
+
+double TextFile::EndfFloat(const char* str, int len)
+{
+  return ParseFloat(str, len, true);
+}
+
+int TextFile::ToInt(const char* str, int len)
+{
+  const char* end = str + len;
+  long ret = 0;
+  bool neg = false;
+
+  while(str < end && isspace((unsigned char)*str)) str++;
+
+  if(str < end && (*str == '+' || *str == '-'))
+    neg = (*str++ == '-');
+
+  while(str < end && isdigit((unsigned char)*str))
+    ret = ret*10 + (*str++ - '0');
+
+  return int(neg ? -ret : ret);
+}
+
+double TextFile::ParseFloat(const char* str, int len, bool endf)
+{
+  // Powers of ten that are exactly representable as doubles:
+  static const double pow10[] =
+    { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+  const char* p = str;
+  const char* end = str + len;
+  const char* exp_str;
+
+  unsigned long long mant = 0;
+  int num_digits = 0;
+  int exp10 = 0;
+  int exp_val = 0;
+  int exp_pos = -1;
+  bool neg = false;
+  bool exp_neg = false;
+  bool any_digit = false;
+  double ret;
+
+  while(p < end && isspace((unsigned char)*p)) p++;
+
+  if(p < end && (*p == '+' || *p == '-'))
+    neg = (*p++ == '-');
+
+  // Blank fields and text are zero, as they are for strtod.  Leave anything
+  // else that is not a plain decimal number (inf, nan, hex...) to strtod:
+  if(p == end) return 0.0;
+
+  if(!(isdigit((unsigned char)*p) || *p == '.'))
+    {
+      if(strchr("iInN", *p) == NULL) return 0.0;
+
+      return SlowFloat(str, len, -1);
+    }
+
+  // Mantissa, without its leading zeros.  Only the first 15 significant
+  // digits are kept, which are always exact:
+  for(; p < end && isdigit((unsigned char)*p); p++)
+    {
+      any_digit = true;
+      if(num_digits || *p != '0')
+	{
+	  if(num_digits++ < 15) mant = mant*10 + (*p - '0');
+	}
+    }
+
+  if(any_digit && mant == 0 && p < end && (*p == 'x' || *p == 'X'))
+    return SlowFloat(str, len, -1);
+
+  if(p < end && *p == '.')
+    for(p++; p < end && isdigit((unsigned char)*p); p++)
+      {
+	any_digit = true;
+	exp10--;
+	if(num_digits || *p != '0')
+	  {
+	    if(num_digits++ < 15) mant = mant*10 + (*p - '0');
+	  }
+      }
+
+  if(!any_digit) return SlowFloat(str, len, -1);
+
+  // Exponent, which in ENDF style can start directly with its sign:
+  exp_str = NULL;
+  if(p < end && (*p == 'e' || *p == 'E'))
+    exp_str = p + 1;
+  else if(endf && p < end && (*p == '+' || *p == '-'))
+    exp_str = p;
+
+  if(exp_str)
+    {
+      if(exp_str < end && (*exp_str == '+' || *exp_str == '-'))
+	exp_neg = (*exp_str++ == '-');
+
+      // An exponent needs at least one digit:
+      if(exp_str < end && isdigit((unsigned char)*exp_str))
+	{
+	  if(*p != 'e' && *p != 'E') exp_pos = p - str;
+
+	  for(; exp_str < end && isdigit((unsigned char)*exp_str); exp_str++)
+	    if(exp_val < 10000) exp_val = exp_val*10 + (*exp_str - '0');
+
+	  exp10 += exp_neg ? -exp_val : exp_val;
+	}
+    }
+
+  if(mant == 0) return neg ? -0.0 : 0.0;
+
+  if(num_digits > 15 || exp10 < -22 || exp10 > 22)
+    return SlowFloat(str, len, exp_pos);
+
+  // Both the mantissa and the power of ten are exact, so that the result is
+  // correctly rounded:
+  ret = double(mant);
+  if(exp10 < 0)
+    ret /= pow10[-exp10];
+  else
+    ret *= pow10[exp10];
+
+  return neg ? -ret : ret;
+}
+
+double TextFile::SlowFloat(const char* str, int len, int expPos)
+{
+  string buf;
+
+  if(len <= 0) return 0.0;
+
+  buf.assign(str, len);
+  if(expPos >= 0) buf.insert(expPos, "E");
+
+  return strtod(buf.c_str(), NULL);
+}
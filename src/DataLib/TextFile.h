@@ -0,0 +1,138 @@
+#ifndef TEXTFILE_H
+#define TEXTFILE_H
+
+#include <string>
+#include <vector>
+
+#include "FeindNs.h"
+
+/// A read-only text file held in memory, used by the FEIND parsers
+/** The file is mapped into memory when possible, or else read into it at
+ *  once. It can be read sequentially, with functions that behave like
+ *  getline(), get() and the >> operator of an istream, or at random through
+ *  an index of its lines. Numbers are parsed in place, without copying the
+ *  fields into strings.
+ */
+class FEIND::TextFile
+{
+ public:
+  /// The main constructor
+  /** \param[in] fileName
+   *  The path to the file. If the file cannot be opened, IsOpen() returns
+   *  false.
+   */
+  TextFile(const std::string& fileName);
+
+  ~TextFile();
+
+  /// Returns true if the file was opened
+  bool IsOpen() const { return Open; }
+
+  //*** SEQUENTIAL ACCESS ***//
+
+  /// Read the characters up to the next delimiter into str, as getline()
+  /** \return
+   *  False if the end of the file was reached before any character was
+   *  read.
+   */
+  bool GetLine(std::string& str, char delim = '\n');
+
+  /// Read the next whitespace delimited token into str, as the >> operator
+  TextFile& operator>>(std::string& str);
+
+  /// Read the next whitespace delimited token as a floating point number
+  /** This is the same as reading a token with the >> operator and converting
+   *  it with atof(), but the token is not copied.
+   */
+  double ReadFloat();
+
+  /// Read a single character, as get()
+  int Get();
+
+  /// Returns true once a read reached the end of the file, as eof()
+  bool Eof() const { return AtEof; }
+
+  //*** RANDOM ACCESS ***//
+
+  /// Build the index of lines used by the functions below
+  void IndexLines();
+
+  /// The number of lines in the index
+  int NumLines() const { return LineStart.size(); }
+
+  /// The length of a line, without its newline character
+  int LineLength(int line) const;
+
+  /// Returns true if the columns of a line match the string tag
+  bool Match(int line, int col, const char* tag) const;
+
+  /// Parse a fixed-width field of a line as an ENDF floating point number
+  /** See EndfFloat(). Fields that extend past the end of the line are
+   *  truncated, and lines past the end of the file are blank.
+   */
+  double Float(int line, int col, int width) const;
+
+  /// Parse a fixed-width field of a line as an integer, as atoi()
+  int Int(int line, int col, int width) const;
+
+  //*** NUMBER PARSING ***//
+
+  /// Convert a string of len characters to a double, as atof()
+  /** Numbers with up to 15 significant digits and a decimal exponent of at
+   *  most 22 are converted exactly with a single multiplication or division
+   *  by a power of ten, which gives the same correctly rounded result as
+   *  atof(). Others are handed to strtod().
+   */
+  static double ToFloat(const char* str, int len);
+
+  /// Convert a string to a double, allowing ENDF style exponents
+  /** In ENDF files, the 'E' of the exponent is usually left out to save a
+   *  column, as in "1.234567+5". As for ToFloat(), otherwise.
+   */
+  static double EndfFloat(const char* str, int len);
+
+  /// Convert a string of len characters to an integer, as atoi()
+  static int ToInt(const char* str, int len);
+
+ private:
+  /// The name of the file
+  std::string FileName;
+
+  /// The contents of the file
+  const char* Data;
+
+  /// The size of the contents
+  size_t Size;
+
+  /// True if Data is mapped, false if it points into Contents
+  bool Mapped;
+
+  /// The contents of files that could not be mapped
+  std::string Contents;
+
+  /// True if the file was opened
+  bool Open;
+
+  /// The position of the sequential reads
+  size_t Pos;
+
+  /// True once a sequential read reached the end of the file
+  bool AtEof;
+
+  /// The offset of the start of each line
+  std::vector<size_t> LineStart;
+
+  /// Get a pointer to a field, and its length after truncation to the line
+  int Field(int line, int col, int width, const char*& str) const;
+
+  /// The conversion behind ToFloat() and EndfFloat()
+  static double ParseFloat(const char* str, int len, bool endf);
+
+  /// Fall back on strtod() for numbers that cannot be converted exactly
+  /** An 'E' is inserted before the character at expPos, if it is not
+   *  negative, to complete an ENDF style exponent.
+   */
+  static double SlowFloat(const char* str, int len, int expPos);
+};
+
+#endif
@@ -4,6 +4,8 @@
 #ifndef FLUX_H
 #define FLUX_H
 
+#include "NameIndex.h"
+
 /* flux formats */
 #define FLUX_HEAD 0
 #define FLUX_D 1
@@ -53,6 +55,14 @@ protected:
   /// The pointer to the next flux description in the list.
   Flux* next;
 
+  /// The 0-based ordinal number of this flux in the list, set when it
+  /// is added to the index of a preceding object.
+  int fluxNum;
+
+  /// The hash index of the names of the following flux descriptions,
+  /// built on the first search through this object.
+  NameIndex<Flux> *nameIdx;
+
 public:
   /// Default constructor
   Flux(int inFormat=FLUX_HEAD, const char* flxName=NULL, 
@@ -66,7 +76,7 @@ public:
   /** Deletes storage for the flux identifier and the flux file name.
       The whole list is destroyed by deleting the next pointer. */
   ~Flux()
-    { delete fileName; delete fluxName; delete next; };
+    { delete fileName; delete fluxName; delete nameIdx; delete next; };
 
   /// Overloaded assignment operator
   Flux& operator=(const Flux&);
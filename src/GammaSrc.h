@@ -20,6 +20,12 @@
 #define GAMMASRC_EXPOSURE 4
 #define GAMMASRC_EXPOSURE_CYLINDRICAL_VOLUME 5
 
+/* block size (isotopes and intervals) of the adjoint dose table product */
+#define ADJDOSE_BLOCK 64
+
+/* block size (isotopes and mixtures) of the contact dose table product */
+#define CDOSE_BLOCK 64
+
 class GammaSrc
 {
 protected:
@@ -40,6 +46,27 @@ protected:
   float detvolume; // detector volume
   VectorCache gammaMultCache;
 
+  /* dense adjoint dose data: adjFlux is nAdjVols x nGroups, read once
+     from the adjoint field file, and adjDoseTable is the isotope x
+     interval table of adjoint dose conversions, indexed through
+     adjIsoIdx */
+  int nAdjVols;
+  double *adjFlux, *adjVolSize, *adjDoseTable;
+  std::map<int,int> adjIsoIdx;
+  void calcAdjDoseTable(std::set<int>&);
+
+  /* dense contact dose data: mixAtten is nDoseMixs x nGroups, read
+     once from the attenuation data file, and doseTable is the isotope
+     x mixture table of contact dose conversions, indexed through
+     doseIsoIdx */
+  int nDoseMixs;
+  double *mixAtten, *doseTable;
+  std::map<int,int> doseIsoIdx;
+  void calcDoseTable(std::set<int>&);
+
+  /* binary R2S photon source file, if requested */
+  SrcWriter *r2sWriter;
+
   int findGroup(float);
   double subIntegral(int,int,float*,float*,double,double);
 
@@ -67,12 +94,17 @@ public:
     { gSrcFile << isoName << "\t" << coolTime;};
   void writeIsotope(double*,double);
   void writeTotal(double*,int,std::vector<std::string>);
+  void openR2S(const char*,int,CoolingTime*,int,int);
+  SrcWriter* getR2SWriter()
+    { return r2sWriter; };
 
   double calcDoseConv(int,double*);
   double calcAdjDose(int,double*,double); 
   double calcExposureDoseConv(int,double*);
-  void setGammaAttenCoef(Mixture*);
-  void setAdjDoseData(Volume*);
+  void setGammaAttenCoef(Mixture*,const std::vector<int>* targets=NULL);
+  void setAdjDoseData(Volume*,const std::vector<int>* targets=NULL);
+  double getAdjDose(int,int,double*,double);
+  double getDoseConv(int,int);
 
   int getNumGrps()
     { return nGroups; };
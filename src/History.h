@@ -5,6 +5,7 @@
 #define HISTORY_H
 
 #include "Input_def.h"
+#include "NameIndex.h"
 
 /** \brief This class is invoked as a linked list and describes the 
  *         various pulsing histories used in the problem.
@@ -39,6 +40,10 @@ protected:
   /// The next History in the list of possible pulsing histories.
   History* next;
 
+  /// The hash index of the names of the following Histories, built on
+  /// the first search through this object.
+  NameIndex<History> *nameIdx;
+
 public:
   /// Default constructor
   History(const char *name=IN_HEAD);
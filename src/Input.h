@@ -1,5 +1,6 @@
 /* $Id: Input.h,v 1.7 2003-01-13 04:34:57 fateneja Exp $ */
 #include "alara.h"
+#include <vector>
 
 #ifndef INPUT_H
 #define INPUT_H
@@ -112,6 +113,12 @@ protected:
   
   /// The head of the linked list of output defintions.
   OutputFormat *outListHead;
+
+  /// The head of the linked list of scenarios of a sweep.
+  Scenario *scenListHead;
+
+  /// The scenario most recently added to the list.
+  Scenario *scenList;
   
 public:
   /// Default constructor
@@ -134,6 +141,12 @@ public:
   /// This function performs the post-processing of the results.
   void postProc(Root*);
 
+  /// This function tallies the results of a forward calculation into
+  /// the intervals like postProc(), but returns the totals of each
+  /// interval in the arguments instead of writing any output.
+  void getResults(Root*, std::vector<std::vector<int> >&,
+		  std::vector<std::vector<double> >&);
+
    /// This function is similar to the globally defined
    /// clearComment(...).
   void clearIncludeComment();
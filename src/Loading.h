@@ -5,6 +5,7 @@
 #define LOADING_H
 
 #include "Input_def.h"
+#include "NameIndex.h"
 
 /** \brief This class is invoked as a linked list and cross-references 
  *         the zones with a particular material loading. 
@@ -52,6 +53,10 @@ protected:
   /// The next Loading object in this list.
   Loading *next;
 
+  /// The hash indices of the zone names and mixture names of the
+  /// following Loadings, built on the first search through this object.
+  NameIndex<Loading> *zoneIdx, *mixIdx;
+
 public:
   ///  Default constructor 
   Loading(const char* name=IN_HEAD, const char *mxName=NULL, bool inUserVolFlag=FALSE, double inUserVol=0.0);
@@ -85,7 +90,7 @@ public:
 
   /// This function is responsible for writing the results to standard
   /// output.
-  void write(int,int,CoolingTime*,int,int);
+  void write(int,int,CoolingTime*,int);
 
   /// Inline access to the 'next' pointer.  
   Loading* advance() { return next; };
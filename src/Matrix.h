@@ -13,6 +13,8 @@ class Matrix
   friend void Chain::fillTMat(Matrix&, double, int);
   friend void Chain::setDecay(Matrix&, double);
   friend void Chain::mult(Matrix&, Matrix&, Matrix&);
+  friend void Chain::setDecayAll(Matrix*, double*, int);
+  friend void Chain::decayAll(Matrix*, Matrix*, Matrix&, int);
 
 protected:
   int size;
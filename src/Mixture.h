@@ -5,6 +5,8 @@
 #define MIXTURE_H
 
 #include "Input_def.h"
+#include "NameIndex.h"
+#include <set>
 
 /** \brief This class is invoked as a linked list and describes the 
  *         various mixtures used in the problem.  
@@ -89,14 +91,21 @@ protected:
   double *total;
   
   /// Variable for contact dose
+  /** This points into the dense attenuation array of the GammaSrc
+      object that set it, in the row given by 'gammaIdx'. */
   double *gammaAttenCoef;
 
-  /// Variable for contact dose
-  DataCache doseConvCache;
+  /// The ordinal number of this mixture in the contact dose table of
+  /// the GammaSrc object.
+  int gammaIdx;
  
   /// The next Mixture in the list of possible Mixtures.
   Mixture *next;
 
+  /// The hash index of the names of the following Mixtures, built on
+  /// the first search through this object.
+  NameIndex<Mixture> *nameIdx;
+
   /// When the Mixture passed as the argument is referenced in a
   /// COMP_SIM Component, the Component is replaced with the Component
   /// list of the mixture definition to which it is similar.  
@@ -143,9 +152,23 @@ public:
   /// contain this mixture.  
   void solve(Chain*, topSchedule*);
 
+  /// Function simply passes the two arguments, the chain information
+  /// and a scenario of a sweep, to the list of intervals which contain
+  /// this mixture.
+  void solve(Chain*, Scenario*);
+
   /// Function simply calls Volume::writeDump() 
   void writeDump();
 
+  /// Function simply calls Volume::writeDump() for a scenario.
+  void writeDump(Scenario*);
+
+  /// Function simply calls Volume::writeTally(...).
+  void writeTally(FILE*);
+
+  /// Function simply calls Volume::readTally(...).
+  void readTally(FILE*);
+
   /// Function simply passes the argument to the list of intervals which
   /// contain this mixture in order to read the dump file.
   void readDump(int);
@@ -156,16 +179,25 @@ public:
 
   /// This function is responsible for writing the results to standard
   /// output.  
-  void write(int,int,CoolingTime*,int,int);
+  void write(int,int,CoolingTime*,int);
 
   /// Increments userVol by parameter value.
   void incrUserVol(double volumeUserVol) {userVol+=volumeUserVol;};
 
-  // NEED COMMENT
+  /// This function looks up the contact dose conversion of the
+  /// isotope given by the first argument for this mixture, in the
+  /// table of the GammaSrc object given by the second argument.
   double getDoseConv(int, GammaSrc*);
 
-  // NEED COMMENT
-  void setGammaAttenCoef(int, ifstream&);
+  /// This function reads the gamma attenuation data for each element
+  /// from the stream, and calculates the attenuation coefficients of
+  /// each mixture into its row of the dense array passed as the last
+  /// argument.
+  void setGammaAttenCoef(int, ifstream&, double*);
+
+  /// This function adds the isotopes of the output lists of all the
+  /// mixtures to the set passed as its argument.
+  void getIsoList(std::set<int>&);
 
   /// This function finds the Root object
   Component* getComp(int, double&, Component*);
@@ -189,6 +221,10 @@ public:
   /// name.
   Mixture* find(char*);
 
+  /// Function to count the number of elements in this list, i.e. the
+  /// number of mixtures.
+  int count();
+
   /// Inline function returns a count of the number of components.
   int getNComps() { return nComps; };
 
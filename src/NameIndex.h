@@ -0,0 +1,69 @@
+/* $Id$ */
+#include "alara.h"
+#include <string>
+#include <unordered_map>
+
+#ifndef NAMEINDEX_H
+#define NAMEINDEX_H
+
+/** \brief This class is a hash index of the names of the elements of
+ *         one of the named input lists (mixtures, zones, fluxes, ...).
+ *
+ *  It is owned by the list element through which the searches are
+ *  made, normally the list head, and indexes the elements following
+ *  that element.  Elements appended to the list after the index was
+ *  built are added by the owner at the next search, by walking from
+ *  'last', so that the index never needs to be rebuilt while the input
+ *  is being read.  As with the linear searches that it replaces, only
+ *  the first element with a given name is found.
+ */
+template <class T> class NameIndex
+{
+protected:
+  /// The map from name to list element.
+  std::unordered_map<std::string,T*> idx;
+
+  /// The last list element added to the index.
+  T* last;
+
+public:
+  /// This constructor sets the list element from which indexing
+  /// starts; that element itself is not indexed.
+  NameIndex(T* start)
+    { last = start; };
+
+  /// Inline access to the last list element added to the index.
+  T* tail()
+    { return last; };
+
+  /// This function adds a list element with the name given in the
+  /// first argument, unless that name is already indexed, and makes it
+  /// the tail.
+  void add(const char* name, T* ptr)
+    { if (name != NULL) idx.emplace(name,ptr); last = ptr; };
+
+  /// This function removes the element with the name given in the
+  /// first argument, before it is deleted from the list.  The second
+  /// argument is the element preceding it, which becomes the tail if
+  /// the removed element was the tail.
+  void remove(const char* name, T* ptr, T* prev)
+    {
+      typename std::unordered_map<std::string,T*>::iterator found
+	= idx.find(name);
+      if (found != idx.end() && found->second == ptr)
+	idx.erase(found);
+      if (last == ptr)
+	last = prev;
+    };
+
+  /// This function returns the element with the name given in the
+  /// argument, or NULL if there is none.
+  T* find(const char* name)
+    {
+      typename std::unordered_map<std::string,T*>::iterator found
+	= idx.find(name);
+      return (found == idx.end()) ? NULL : found->second;
+    };
+};
+
+#endif
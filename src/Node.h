@@ -1,13 +1,24 @@
 /* $Id: Node.h,v 1.15 2003-01-13 04:34:51 fateneja Exp $ */
 
 /*
-  lambdaCache, heatCache, alphaCache, 
- betaCache, gammaCache, wdrCache : DataCache
-   Using this cache system, the decay data used in post-processing
-   only needs to be read from the library once.
+  isoIdx, isoProps : isotope property table
+   The decay data used in post-processing is read from the library
+   only once per isotope, into one dense column for each property.
+  wdrTable : isotope x standard matrix of WDR/clearance factors
+  cpIdx, cpTable : charged particle production table
+   The cross sections for the production of each light ion are
+   gathered from the library only once per isotope.
+  adjData : library records of a reverse calculation
+   The adjoint trees of different targets share most of their
+   parents, so each is read and sorted only once per solution.
 */
 
 #include "alara.h"
+#include <set>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #ifndef NODE_H
 #define NODE_H
@@ -19,6 +30,22 @@
 #define WDR_KZAMODE 0
 #define WDR_SYMMODE 1
 
+/* columns of the isotope property table */
+#define ISOPROP_LAMBDA 0
+#define ISOPROP_HEAT   1
+#define ISOPROP_ALPHA  2
+#define ISOPROP_BETA   3
+#define ISOPROP_GAMMA  4
+#define ISOPROP_NUM    5
+
+/* light ions of the charged particle production table */
+#define CP_ALPHA    0
+#define CP_DEUTERON 1
+#define CP_HELION   2
+#define CP_PROTON   3
+#define CP_TRITON   4
+#define CP_NUM      5
+
 /** \brief This class stores the information about a particular node in a chain.
  *
  *  It is derived publicly from classes NuclearData and TreeInfo.  As a
@@ -42,12 +69,52 @@ protected:
       parents in the binary tree output. */
   int nodenum;
 
-  static DataCache lambdaCache;
-  static DataCache heatCache;
-  static DataCache alphaCache;
-  static DataCache betaCache;
-  static DataCache gammaCache;
-  static DataCache wdrCache;
+  /// This maps each kza to its row of the isotope property table.
+  static std::unordered_map<int,int> isoIdx;
+
+  /// These are the columns of the isotope property table: the decay
+  /// constant and the total, alpha, beta and gamma decay heat (decay
+  /// constant times energy) of each isotope.
+  static std::vector<double> isoProps[ISOPROP_NUM];
+
+  /// This is the row-major matrix of WDR/clearance factors, with one
+  /// row per row of the isotope property table and one column per
+  /// standard (WDR/clearance file).
+  static std::vector<double> wdrTable;
+
+  /// The number of standards in 'wdrTable' and the one used by getWDR().
+  static int nWDR, wdrCol;
+
+  /// This maps each WDR/clearance filename to its column.
+  static std::map<std::string,int> wdrIdx;
+
+  /// This maps each kza to its block of the charged particle
+  /// production table.
+  static std::unordered_map<int,int> cpIdx;
+
+  /// This is the charged particle production table: for each isotope,
+  /// a row-major block of CP_NUM x nGroups cross sections for the
+  /// production of each light ion.
+  static std::vector<double> cpTable;
+
+  /// The kza of each light ion of the charged particle production table.
+  static const int cpKza[CP_NUM];
+
+  /// This maps each kza to its sorted library record in reverse
+  /// calculations.
+  static std::unordered_map<int,NuclearData*> adjData;
+
+  /// The free list of the storage of deleted nodes.
+  static std::vector<void*> freeNodes;
+
+  /// This function returns the row of the isotope given by the
+  /// argument, reading its data and adding it to the table if needed.
+  int isoRow(int);
+
+  /// This function returns the offset of the block of the isotope
+  /// given by the argument in the charged particle production table,
+  /// reading its data and adding it to the table if needed.
+  int cpBlock(int);
 
 
   /// This function searches back up the chain and find the first
@@ -59,9 +126,18 @@ protected:
 public:
   /// The default constructor when called with no arguments
   Node(char* isoName=NULL);
+
+  /// Class-specific allocation recycles the storage of nodes through
+  /// a free list, since a node is created and deleted for every
+  /// extension and retraction of a chain.
+  static void* operator new(size_t);
+
+  /// Class-specific deallocation returns the storage of a node to the
+  /// free list.
+  static void operator delete(void*, size_t);
   
   /// This constructor invokes an initialization list.
-  Node(int,Node*,double*,int,int);
+  Node(int,Node*,RateType*,int,int);
   
   /// This function passes the 'kza' value and 'this' pointer to the
   /// readData() function of the 'dataLib' member object of base class
@@ -71,10 +147,10 @@ public:
   /// This function points the appropriate elements of the
   /// 'Chain::rates' array, passed in argument 1, at the rate vectors
   /// and data for this isotope.
-  void copyRates(double**,const int, int*);
+  void copyRates(RateType**,const int, int*);
 
   /// This function re-initializes the elements of the 'rates' array.
-  void delRates(double**,const int, int*);
+  void delRates(RateType**,const int, int*);
 
   /// This function combines the current state with the information
   /// passed in the argument to determine a new state.
@@ -105,7 +181,7 @@ public:
 
   /// This function is used to determine the indexing information for
   /// the RateCache concept.
-  void getRxnInfo(double*,int&,int&,int&);
+  void getRxnInfo(RateType*,int&,int&,int&);
 
   /// Inline function that sends information about the current node to the
   /// statistics routines for diagnostic and tree output.
@@ -125,39 +201,69 @@ public:
 	}
     };
 
-  /// This function accesses the data library to get the decay constant
-  /// for the isotope indicated by the argument, first checking in the
-  /// cache.
-  double getLambda(int);
-
-  /// This function accesses the data library to get the total decay
-  /// heat for the isotope indicated by the argument, first checking in
-  /// the cache.
-  double getHeat(int);
-
-  /// This function accesses the data library to get the alpha decay
-  /// heat for the isotope indicated by the argument, first checking in
-  /// the cache.
-  double getAlpha(int);
+  /// This function empties the tables of data read from the library,
+  /// when it is replaced by another one.
+  static void clearTables();
+
+  /// This function deletes the library records kept for the trees of
+  /// the targets of a reverse calculation.
+  static void clearAdjData();
+
+  /// This function fills the isotope property table for all the
+  /// isotopes in the argument, so that post-processing only needs to
+  /// look up values.
+  void buildIsoTable(std::set<int>&);
+
+  /// Inline function to get the decay constant for the isotope
+  /// indicated by the argument from the isotope property table.
+  double getLambda(int setKza)
+    { return isoProps[ISOPROP_LAMBDA][isoRow(setKza)]; };
+
+  /// Inline function to get the total decay heat for the isotope
+  /// indicated by the argument from the isotope property table.
+  double getHeat(int setKza)
+    { return isoProps[ISOPROP_HEAT][isoRow(setKza)]; };
+
+  /// Inline function to get the alpha decay heat for the isotope
+  /// indicated by the argument from the isotope property table.
+  double getAlpha(int setKza)
+    { return isoProps[ISOPROP_ALPHA][isoRow(setKza)]; };
+
+  /// Inline function to get the beta decay heat for the isotope
+  /// indicated by the argument from the isotope property table.
+  double getBeta(int setKza)
+    { return isoProps[ISOPROP_BETA][isoRow(setKza)]; };
+
+  /// Inline function to get the gamma decay heat for the isotope
+  /// indicated by the argument from the isotope property table.
+  double getGamma(int setKza)
+    { return isoProps[ISOPROP_GAMMA][isoRow(setKza)]; };
+
+  /// This function returns the WDR factor of the isotope indicated by
+  /// the argument for the current standard, or 0 if not listed.
+  double getWDR(int);
 
-  /// This function accesses the data library to get the beta decay heat
-  /// for the isotope indicated by the argument, first checking in the
-  /// cache.
-  double getBeta(int);
+  /// This function returns a pointer to the WDR factors of the isotope
+  /// indicated by the argument for all standards, or NULL if it is not
+  /// listed in any of them.
+  static double* getWDRRow(int);
 
-  /// This function accesses the data library to get the gamma decay
-  /// heat for the isotope indicated by the argument, first checking in
-  /// the cache.
-  double getGamma(int);
+  /// This function returns a pointer to the CP_NUM x nGroups block
+  /// of charged particle production cross sections of the isotope
+  /// indicated by the argument.
+  const double* getCPXS(int);
 
-  double getWDR(int);
+  /// This function reads the WDR thresholds of all the files in the
+  /// argument, each only once, into the columns of 'wdrTable'.
+  static void loadWDR(std::vector<char*>&);
 
-  /// Get charged particle cross sections
-  double** getCPXS(int findKZA);
+  /// This function returns the column of 'wdrTable' for the file named
+  /// in the argument, or -1 if it was not loaded.
+  static int findWDR(const char*);
 
-  /// This function opens the file whose name is given in the argument
-  /// and reads the WDR thresholds into the wdrCache.
-  static void loadWDR(char*);
+  /// Inline function to set the standard used by getWDR().
+  static void setWDR(int col)
+    { wdrCol = col; };
 };
 
 #endif
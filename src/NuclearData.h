@@ -4,6 +4,14 @@
 #ifndef NUCLEARDATA_H
 #define NUCLEARDATA_H
 
+#include <unordered_set>
+#include "ArrayPool.h"
+
+/* offsets after the group-wise rates of the elements of a rate vector */
+#define RATE_FIRST 1
+#define RATE_END   2
+#define RATE_EXTRA 3
+
 /** \brief Stores the nuclear data information for a particular isotope 
            in the chain.
  *
@@ -27,6 +35,23 @@ protected:
   /// The number of groups in the data library.
   static int nGroups;
 
+  /// The type and name of the open data library, if it is an ALARA
+  /// library that can be kept open for the next problem.
+  static std::string libSpec;
+
+  /// Free-list pools for the rate vectors and the per-reaction arrays
+  /// of the nodes.
+  /** Nodes are created and deleted for every extension and
+      retraction of the chains, so their storage is recycled through
+      these pools rather than the general-purpose allocator. */
+  static ArrayPool<RateType> ratePool;
+  static ArrayPool<RateType*> pathPool;
+  static ArrayPool<int> relationPool;
+  static ArrayPool<char*> emittedPool;
+
+  /// The distinct emitted particle strings, shared by all nodes.
+  static std::unordered_set<std::string> emittedNames;
+
   /// The number of reactions to be processed for this isotope.
   /** This can be interpreted physically in a number of ways depending
       on the library structure, but computationally it represents the
@@ -45,20 +70,29 @@ protected:
 
   /// This is an array of character strings indicating the type of
   /// reaction/emitted particles for each reaction path.
+  /** The strings are stored once in NuclearData::emittedNames. */
   char **emitted;
 
+  /// The length of the NuclearData::relations and
+  /// NuclearData::emitted arrays, and one less than that of the
+  /// NuclearData::paths array, as allocated.
+  int nAlloc;
+
   /// This is a rate vector describing the "single" transfer rate
   /// related to the "previous" isotope by both transmutation (groups
   /// 1..N) and decay (group N+1).
   /** For forward calculations, this is the production rate, and for
-      backward, it is the total destruction rate. */
-  double *single;
+      backward, it is the total destruction rate.  Like all rate
+      vectors, it ends with the bounds of the range of groups holding
+      its non-zero rates (see setRate()).  The groups outside that
+      range are never set, and must not be read. */
+  RateType *single;
   
   /** This is an array of rate vectors describing the rates related to
       the NuclearData::nPaths "next" isotopes by both transmutation
       (groups 1..N) and decay (group N+1) for each reaction and the
       total reaction rate. */
-  double **paths;
+  RateType **paths;
     
   /// This stores the average beta, gamma and alpha energy per
   /// nuclear decay.
@@ -66,16 +100,57 @@ protected:
 
   /// This will point to the production rate, whichever that happens
   /// to be.
-  double *P;
+  RateType *P;
  
   /// This will be set to point to the destruction rate, whichever
   /// that happens to be.
-  double *D;
+  RateType *D;
 
   /// {Chain Building} This function checks all the reactions and
   /// strips the ones that contain no decay rate.
   int stripNonDecay();
 
+  /// This function allocates the NuclearData::relations,
+  /// NuclearData::emitted and NuclearData::paths arrays for the
+  /// number of reactions given in the argument.
+  void allocPaths(int);
+
+  /// This inline function returns a rate vector from the pool.
+  static RateType* newRate()
+    { return ratePool.get(nGroups+RATE_EXTRA); };
+
+  /// This inline function returns a rate vector to the pool.
+  static void deleteRate(RateType* rate)
+    { ratePool.put(rate,nGroups+RATE_EXTRA); };
+
+  /// This function fills the group-wise rates of the rate vector in the
+  /// first argument with the cross-sections in the second argument,
+  /// scaled by the third, over the range of their non-zero groups.
+  static void setRate(RateType*, float*, double);
+
+  /// This inline function empties the range of non-zero groups of a
+  /// rate vector.
+  static void clearRate(RateType* rate)
+    { rate[nGroups+RATE_FIRST] = 0; rate[nGroups+RATE_END] = 0; };
+
+  /// This function adds the rate vector in the second argument to the
+  /// one in the first, widening the range of non-zero groups of the
+  /// first as needed.
+  static void addRate(RateType*, RateType*);
+
+  /// This function copies the non-zero groups, the decay rate and the
+  /// group range of the rate vector in the second argument to the one
+  /// in the first.
+  static void copyRate(RateType*, RateType*);
+
+  /// This function returns the shared copy of an emitted particle
+  /// string.
+  static char* internEmitted(const char*);
+
+  /// {Input Handling} This function opens a new DataLib object of the
+  /// type given in the first argument, closing any open one.
+  static void openDataLib(char*,istream&);
+
   /// {Chain Building} This function sorts all the reaction path data,
   /// moving the decay reaction paths to the beginning of the list.
   void sortData();
@@ -90,14 +165,32 @@ protected:
   /// 'dataLib'.
   static void closeDataLib();
 
+  /// {Service} This function gives a forked process its own access to
+  /// the files of 'dataLib'.
+  static void reopenDataLib();
+
   /// {Input Handling} This inline function just sets NuclearData::mode
   /// variable into the reverse mode.
   static void modeReverse() { mode = MODE_REVERSE;};
 
+  /// {Input Handling} This inline function sets NuclearData::mode back
+  /// into the forward mode.
+  static void modeForward() { mode = MODE_FORWARD;};
+
   /// {Service/Access} This inline function provides access to 
   /// NuclearData::mode
   static int getMode() { return mode; };
 
+  /// {Service/Access} This inline function returns the first group of
+  /// the range of non-zero groups of a rate vector.
+  static int firstGroup(RateType* rate)
+    { return (int)rate[nGroups+RATE_FIRST]; };
+
+  /// {Service/Access} This inline function returns the group after the
+  /// range of non-zero groups of a rate vector.
+  static int endGroup(RateType* rate)
+    { return (int)rate[nGroups+RATE_END]; };
+
   /*
     NuclearData(double*)
     The basic constructor is used when adding new Node's to the chain.
@@ -128,6 +221,11 @@ protected:
   /// routines.
   void setData(int, float *, int *, char **, float **, float, float*);
 
+  /// {%Chain Building} This function sets the data from a previously
+  /// read record instead of the library, leaving this object in the
+  /// same state as the other form of setData().
+  void setData(const NuclearData&);
+
 };
 
 
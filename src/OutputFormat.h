@@ -71,6 +71,12 @@ protected:
   GammaSrc *exposureDose;
 
   GammaSrc *exposureCylVolDose;
+
+  /// The name of the binary R2S photon source file, if requested, and
+  /// whether it should include the per-isotope sources.
+  char *r2sFileName;
+  int r2sDetail;
+
   /// The next object in the linked-list.
   OutputFormat *next;
 
@@ -104,10 +110,12 @@ public:
   /// This function steps through the linked list of output descriptions
   /// and writes each one in sequence 
   /** It does this by calling the write() function on the list of intervals,
-      zones or mixtures, as determined by the 'resolution' member. The last
-      argument is the kza number for the target isotope for which the 
-      current invocation is being called. */
-  void write(Volume*,Mixture*,Loading*,CoolingTime*,int targetKza=0);
+      zones or mixtures, as determined by the 'resolution' member. */
+  void write(Volume*,Mixture*,Loading*,CoolingTime*);
+
+  /// This function loads the WDR/clearance files of all the output
+  /// blocks in the list, each only once, before post-processing.
+  void loadWDR();
 };
 
 #endif
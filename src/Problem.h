@@ -0,0 +1,196 @@
+/* $Id$ */
+/* This header is installed with libalara and is the only one needed by
+ * an embedding program, so it does not include alara.h. */
+
+#ifndef PROBLEM_H
+#define PROBLEM_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+/** \brief This class is the in-process interface to ALARA, for
+ *         programs that link with libalara rather than running the
+ *         alara executable.
+ *
+ *  A problem is built from its geometry, mixtures, fluxes, schedules
+ *  and cooling times through the member functions below, which
+ *  correspond to the blocks of the input file described in the
+ *  Users' Guide.  These are given to the usual input processing, so
+ *  that they are checked in the same way as an input file, and the
+ *  fluxes are passed as arrays without being written to files.
+ *
+ *  solve() can be called any number of times, on this or other
+ *  Problem objects.  The nuclear data library and the isotope data
+ *  read from it stay open and cached between solutions as long as the
+ *  same library is named.  The results are returned as arrays for
+ *  each interval, rather than written as text.  An error in the
+ *  problem is returned by solve() instead of ending the program.
+ *  Only forward calculations are supported: a problem with a target
+ *  is an error.
+ */
+
+class Problem
+{
+protected:
+  /// The number of Problem objects created, used to give each one
+  /// distinct names for its input and fluxes.
+  static int nProblems;
+
+  /// The prefix of the names of the input and fluxes of this problem.
+  std::string prefix;
+
+  /// The blocks of the input describing the geometry and intervals,
+  /// the material loading, and the problem-wide settings.
+  std::string geomInput, volInput, loadInput, libInput;
+
+  /// The bodies of the mixture, schedule and pulsing history blocks,
+  /// indexed by their names.
+  std::map<std::string,std::string> mixInput, schedInput, histInput;
+
+  /// The flux blocks, and the contents of their flux "files".
+  std::string fluxInput;
+  std::map<std::string,std::string> fluxData;
+
+  /// The cooling times, with their units.
+  std::string coolInput;
+
+  /// Any other input blocks given verbatim.
+  std::string extraInput;
+
+  /// The name of the binary dump file.
+  std::string dumpFname;
+
+  /// The truncation, ignore and impurity parameters.
+  double truncLimit, ignoreLimit, impurityDefn, impurityTruncLimit;
+
+  /// The number of results for each isotope: the shutdown result
+  /// followed by one for each cooling time.
+  int nResults;
+
+  /// The kza of each isotope, and its number densities, for each
+  /// interval of the last solution.
+  std::vector<std::vector<int> > isotopes;
+  std::vector<std::vector<double> > numDens;
+
+  /// The message of the error that ended the last solution, if any.
+  std::string errorMsg;
+
+  /// This function returns the complete input of the problem.
+  std::string getInput();
+
+public:
+  /// Default constructor
+  Problem();
+
+  /// This function names the nuclear data library given to the
+  /// data_library block: its type (e.g. "alaralib") and name.
+  void setDataLib(const char*,const char*);
+
+  /// These functions name the material and element libraries.
+  void setMatLib(const char*);
+  void setEleLib(const char*);
+
+  /// This function sets the geometry type.
+  void setGeometry(const char*);
+
+  /// This function sets the major radius (second argument FALSE) or
+  /// minor radius (TRUE) of a toroidal geometry.
+  void setRadius(double,int minor=0);
+
+  /// This function adds a dimension of the type in the first argument,
+  /// starting at the second argument, with the numbers of intervals
+  /// and the boundaries of its zones in the last two.
+  void addDimension(const char*,double,const std::vector<int>&,
+		    const std::vector<double>&);
+
+  /// This function adds an interval with the volume given in the first
+  /// argument to the zone in the second, instead of dimensions.
+  void addInterval(double,const char*);
+
+  /// This function loads the zone in the first argument with the
+  /// mixture in the second ("void" for an empty zone).
+  void addLoading(const char*,const char*);
+
+  /// This function adds a constituent to the mixture named in the
+  /// first argument, creating it if needed: its type ("material",
+  /// "element", "like"...), name, density and volume fraction.
+  void addConstituent(const char*,const char*,const char*,double,double);
+
+  /// This function adds a flux with the name in the first argument.
+  /// The second holds the group-wise fluxes of each interval in turn,
+  /// and the last is the normalization.
+  void addFlux(const char*,const std::vector<double>&,double scale=1);
+
+  /// This function adds a level to the pulsing history named in the
+  /// first argument, creating it if needed: the number of pulses and
+  /// the delay between them, with its unit.
+  void addPulseLevel(const char*,int,double,char);
+
+  /// This function adds an item to the schedule named in the first
+  /// argument, creating it if needed: an irradiation time with its
+  /// unit, the flux, the pulsing history, and the delay after the
+  /// item with its unit.
+  void addScheduleItem(const char*,double,char,const char*,const char*,
+		       double,char);
+
+  /// This function adds the sub-schedule in the second argument to the
+  /// schedule in the first, with the pulsing history and the delay
+  /// after the item with its unit.
+  void addSubSchedule(const char*,const char*,const char*,double,char);
+
+  /// This function adds a cooling time with its unit.
+  void addCoolingTime(double,char);
+
+  /// This function sets the truncation and ignore limits.
+  void setTruncation(double,double ignore=1e-2);
+
+  /// This function sets the impurity definition and its truncation
+  /// limit.
+  void setImpurity(double,double);
+
+  /// This function sets the name of the binary dump file.
+  void setDumpFile(const char*);
+
+  /// This function adds any other input block, such as spatial_norm
+  /// or ref_flux_type, verbatim.
+  void addInput(const char*);
+
+  /// This function solves the problem, keeping the results of each
+  /// interval for the functions below.  It returns 0, or the number
+  /// of the error (see the Users' Guide) that ended the solution.
+  int solve();
+
+  /// Inline function returns the message of the error that ended the
+  /// last solution, or an empty string.
+  const std::string& getError()
+    { return errorMsg; };
+
+  /// Inline function returns the number of intervals of the last
+  /// solution.
+  int getNumIntervals()
+    { return isotopes.size(); };
+
+  /// Inline function returns the number of results for each isotope:
+  /// the shutdown result followed by one for each cooling time.
+  int getNumResults()
+    { return nResults; };
+
+  /// Inline function returns the kza of the isotopes of the interval
+  /// indicated by the argument.  The list is empty for void intervals.
+  const std::vector<int>& getIsotopes(int intvlNum)
+    { return isotopes[intvlNum]; };
+
+  /// Inline function returns the number densities [atoms/cm3 of the
+  /// mixture] of the interval indicated by the argument,
+  /// getNumResults() for each isotope in turn.  These are the values
+  /// of the interval totals in the output of the alara executable.
+  const std::vector<double>& getNumberDensity(int intvlNum)
+    { return numDens[intvlNum]; };
+
+  /// This function returns the activities [Bq/cm3] of the interval
+  /// indicated by the argument, in the same order.
+  std::vector<double> getActivity(int);
+};
+
+#endif
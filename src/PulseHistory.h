@@ -67,6 +67,12 @@ public:
   /// pulsing history.
   Matrix doHistory(Matrix);
 
+  /// This function appends the operations of doHistory(...) to the
+  /// program given in the first argument, for the operation transfer
+  /// matrix in the slot given in the second argument, and returns the
+  /// slot of the result.
+  int compile(SchedProgram&, int);
+
 };
 
 #endif
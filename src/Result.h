@@ -1,5 +1,8 @@
 /* $Id: Result.h,v 1.20 2008-08-06 17:38:10 phruksar Exp $ */
 #include "alara.h"
+#include <set>
+#include <map>
+#include <vector>
 
 #ifndef RESULT_H
 #define RESULT_H
@@ -7,6 +10,13 @@
 /* conversion from eV to Joules */
 #define EV2J 1.6e-19
 
+/* size of the buffer used to merge shard dump files */
+#define BINDUMP_COPYSIZE (1<<20)
+
+/* minimum interval in seconds between synchronizations of the dump
+   file and its journal to disk */
+#define JOURNAL_SYNC_SECS 60
+
 /** \brief This class is used to store the results of each computation.
  *       
  *         A linked list of Result objects will make up two (2) of the 
@@ -28,6 +38,13 @@ protected:
       shutdown result). */
   static int nResults;
 
+  /// This indicates how many blocks of nResults columns are stored for
+  /// each output isotope.
+  /** It is the number of targets during the postprocessing of reverse
+      calculations, whose results are tabulated side by side, and 1
+      otherwise. */
+  static int nTargets;
+
   /// This standard C file descriptor is used for a binary dump of the
   /// results during the course of the calculation.
   /** It is written to after the solution of each root (target) 
@@ -35,6 +52,38 @@ protected:
       post-processing. */
   static FILE* binDump;
 
+  /// The name given for the binary dump file.
+  static char* dumpFname;
+
+  /// This is the shard solved by this process and the number of
+  /// shards (shardNum is -1 if the problem is not sharded).
+  static int shardNum, nShards;
+
+  /// This is the position, in a shard dump file, of the header of the
+  /// current root's block.
+  static long shardBlockPos;
+
+  /// The journal of the roots completed in the binary dump file, its
+  /// name, and the time it was last synchronized to disk.
+  static FILE* journal;
+  static char* journalFname;
+  static time_t lastSync;
+
+  /// This flag indicates whether an interrupted solution is resumed.
+  static int resumeMode;
+
+  /// This flag indicates whether the binary dump files are unnamed
+  /// temporary files, as for the jobs of a server.
+  static int tmpDump;
+
+  /// This is the index of the last root whose results are complete in
+  /// the binary dump file, or -1.
+  static int lastRoot;
+
+  /// This function truncates the binary dump file after the last root
+  /// recorded in the journal and positions it there.
+  static void resumeDump();
+
   /// This value (-1) is written to the dump file following each root
   /// isotope's record
   /** It is used as a delimiter when reading the file during 
@@ -56,6 +105,14 @@ protected:
   /// String to print as reminder of current output type
   static char* outReminderStr;
 
+  /// This lists the columns of Node's WDR matrix for which all the
+  /// WDR/clearance indices are gathered in a single pass, or is NULL.
+  static std::vector<int>* wdrCols;
+
+  /// This stores, for each interval/zone/mixture, the total index for
+  /// each of the standards in 'wdrCols' (row-major by standard).
+  static std::map<int,std::vector<double> > wdrTotals;
+
   /// This indicates the kza number of the output isotope which this
   /// data is for.
   int kza;
@@ -66,6 +123,10 @@ protected:
 
   /// This is the result of the next isotope in this list of results.
   Result* next;
+
+  /// This function returns the multiplier of a response (first
+  /// argument) for an isotope (second argument).
+  static double getMultiplier(int,int,Mixture*,Volume*,double*&);
   
 public:
   /// Inline function initializes the number of results to be stored in
@@ -73,6 +134,18 @@ public:
   static void setNResults(int numRes)
     { nResults = numRes; };
 
+  /// This function sets the list of targets whose results are
+  /// tabulated side by side in reverse calculations.
+  static void setTargets(const std::vector<int>&);
+
+  /// This function returns the index of the block of columns of the
+  /// target given in the argument.
+  static int findTarget(int);
+
+  /// Inline function returning the number of columns of each table.
+  static int getNumCols()
+    { return nResults*nTargets; };
+
   // NEED COMMENTS
   static void setGammaSrc(GammaSrc *setGammaSrc)
     { gammaSrc = setGammaSrc; };
@@ -98,6 +171,14 @@ public:
   /// the argument and returns a pointer to the object with that KZA.
   Result* find(int);
   
+  /// This function adds the kza of every isotope in this list to the
+  /// set given in the argument.
+  void getIsoList(std::set<int>&);
+
+  /// This function appends the kza and the results of every isotope in
+  /// this list to the arguments.
+  void getList(std::vector<int>&, std::vector<double>&);
+
   /// Inline function deletes a list of results.
   void clear()
     { delete next; next = NULL; };
@@ -111,8 +192,9 @@ public:
   void tallySoln(Chain*,topScheduleT*);
 
   /// This function adds the results in 'this' list to the
-  /// list passed in the first argument
-  void postProcTarget(Result*, Mixture*);
+  /// list passed in the first argument, in the block of columns of
+  /// the target given in the last argument.
+  void postProcTarget(Result*, Mixture*, int);
   
   /// This function adds the results in 'this' list to the list passed 
   /// in the first argument.
@@ -125,7 +207,7 @@ public:
   
   /// This does all the work of writing out a table of results, stepping
   /// through the list of results.  
-  void write(int, int, Mixture*, CoolingTime*, double*&, double volume_mass=1,Volume* volPtr=NULL);
+  void write(int, Mixture*, CoolingTime*, double*&, double volume_mass=1,Volume* volPtr=NULL);
   
   /// This function is used to set actMult from the first argument and
   /// metricMult by interpretation of the second argument.
@@ -137,6 +219,16 @@ public:
   static void setReminderStr(char*);
   static char* getReminderStr(){ return outReminderStr;};
 
+  /// This function starts (non-NULL argument) or stops (NULL) the
+  /// gathering of the indices of all the WDR/clearance standards given
+  /// by their columns in the argument.
+  static void collectWDR(std::vector<int>*);
+
+  /// This function writes the combined table of the gathered indices:
+  /// one row per interval/zone/mixture and standard.  The arguments are
+  /// the cooling times, the entity type and the standard filenames.
+  static void writeWDRTotals(CoolingTime*,const char*,std::vector<char*>&);
+
   /// This function opens and initializes the binary dump file used
   /// throughout the solution and postprocessing.
   static void initBinDump(const char*);
@@ -144,6 +236,63 @@ public:
   /// This function dumps the value of nResults to the binary dump file.
   static void dumpHeader();
   
+  /// This function sets the shard solved by this process (first
+  /// argument) out of the number of shards (second argument).
+  static void setShard(int,int);
+
+  /// Inline function indicating whether this process solves the root
+  /// whose 0-based index, in the order of Root::solve(), is given.
+  static int ownsRoot(int rootNum)
+    { return (shardNum < 0 || rootNum % nShards == shardNum); };
+
+  /// These functions surround the dump of each root in a shard dump
+  /// file with its index and its size.
+  static void beginShardBlock(int);
+  static void endShardBlock();
+
+  /// This function sets the mode to resume an interrupted solution.
+  static void setResume()
+    { resumeMode = TRUE; };
+
+  /// This function makes the binary dump files temporary files, which
+  /// are removed when they are closed.
+  static void setTmpDump()
+    { tmpDump = TRUE; };
+
+  /// Inline function indicating whether the binary dump files are
+  /// temporary files.
+  static int tmpDumps()
+    { return tmpDump; };
+
+  /// Inline function indicating whether the results of the root whose
+  /// 0-based index is given are already in the binary dump file.
+  static int rootDumped(int rootNum)
+    { return (rootNum <= lastRoot); };
+
+  /// This function records in the journal that the root whose index
+  /// is given is complete in the binary dump file.
+  static void journalRoot(int);
+
+  /// This function merges the shard dump files of the number of shards
+  /// given in the first argument, for the number of roots given in the
+  /// second argument, into the binary dump file.
+  static void mergeDump(int,int);
+
+  /// Inline function indicating whether the binary dump file holds
+  /// only part of the solution, when solving a shard or resuming.
+  static int partialDump()
+    { return (shardNum >= 0 || resumeMode); };
+
+  /// Inline function providing access to the name of the binary dump
+  /// file.
+  static char* getDumpFname()
+    { return dumpFname; };
+
+  /// This function makes the file given in the argument the binary
+  /// dump file and returns the previous one.
+  static FILE* useDump(FILE* newDump)
+    { FILE *oldDump = binDump; binDump = newDump; return oldDump; };
+
   /// This function checks for the existence of a binary dump file.
   static void xCheck();
 
@@ -151,8 +300,8 @@ public:
   /// beginning of the file, to be read in the post-processing step.
   static void resetBinDump();
   
-  // NEED COMMENT
-  static void closeBinDump() { fclose(binDump); };
+  /// This function closes the binary dump file and its journal.
+  static void closeBinDump();
   
   /// This function writes the results stored in 'this' entire list to the
   /// binary dump file.
@@ -163,6 +312,15 @@ public:
   /// new list of results.
   void readDump();
 
+  /// This function writes the results stored in 'this' entire list, in
+  /// full precision, to the file given in the argument and clears the
+  /// list.  If the file is NULL, the list is only cleared.
+  void writeTally(FILE*);
+
+  /// This function tallies the results written by writeTally(...) to
+  /// the file given in the argument into 'this' list.
+  void readTally(FILE*);
+
 };
   
 #endif
@@ -81,10 +81,24 @@ protected:
       /// solve the chain for each mixture (but not for each component)
       void solve(Chain*, topSchedule*);
 
+      /// solve the chain for each mixture on a scenario of a sweep
+      void solve(Chain*, Scenario*);
+
       /// This function simply calls Mixture::writeDump() on every
       /// mixture containing the root to which this MixCompRef belongs.
       void writeDump();
 
+      /// This function calls Mixture::writeDump() for a scenario on
+      /// every mixture containing the root to which this MixCompRef
+      /// belongs.
+      void writeDump(Scenario*);
+
+      /// These functions call Mixture::writeTally(...) and
+      /// Mixture::readTally(...) on every mixture containing the root
+      /// to which this MixCompRef belongs.
+      void writeTally(FILE*);
+      void readTally(FILE*);
+
       /// This function polls each mixture containing the root to which
       /// this MixCompRef belongs and finds the maximum relative
       /// concentration of this root in any mixture.
@@ -143,6 +157,21 @@ public:
 
   /// This function is the top level of the solution phase.
   void solve(topSchedule*);
+
+  /// This inline function writes the results of this root isotope, as
+  /// tallied so far, to the file given in the argument and clears
+  /// them.  If the file is NULL, they are only cleared.
+  void writeTally(FILE* tallyFile)
+    { mixList->writeTally(tallyFile); };
+
+  /// This inline function tallies the results written by
+  /// writeTally(...) into the results of this root isotope.
+  void readTally(FILE* tallyFile)
+    { mixList->readTally(tallyFile); };
+
+  /// This function merges the dump files written by the number of
+  /// shards given in the argument into the binary dump file.
+  void mergeDump(int);
   
   /// This function calls MixCompRef::readDump() for each root isotope
   /// in the problem.
@@ -0,0 +1,123 @@
+/* $Id$ */
+#include "alara.h"
+
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#define SCENARIO_HEAD -1
+
+#include "Result.h"
+
+/** \brief This class is invoked as a linked list and describes the
+ *         additional scenarios of a parametric sweep.
+ *
+ *  Each scenario names a top level schedule and a scale factor applied
+ *  to every flux.  The chains are built once for each root isotope and
+ *  solved for the problem's own top schedule and then again for each
+ *  scenario, so that the chain building is shared by the whole
+ *  sweep.  The truncation of the chains is
+ *  decided by the largest relative production found in any of the
+ *  scenarios.  The results of each scenario are written to their own
+ *  dump file and reported after those of the main problem.  The first
+ *  element of the problem-wide list has type SCENARIO_HEAD (defined
+ *  through the scenNum member), and contains no problem data.
+ */
+
+class Scenario
+{
+protected:
+  /// The number of this scenario, counting from 0, used to index the
+  /// scenario storage of the intervals.
+  int scenNum;
+
+  /// The descriptive name of this scenario.
+  char *scenName;
+
+  /// The name of the top level schedule solved in this scenario.
+  char *schedName;
+
+  /// The scale factor applied to all the fluxes in this scenario.
+  double fluxScale;
+
+  /// A pointer to the collapsed and compiled top schedule.
+  topSchedule *top;
+
+  /// The dump file for the results of this scenario.
+  FILE *dump;
+
+  /// A pointer to the next Scenario object in the list.
+  Scenario *next;
+
+  /// The first scenario of the sweep, or NULL if there is none.
+  static Scenario *sweep;
+
+  /// The number of scenarios in the sweep.
+  static int nScenarios;
+
+public:
+  /// Default constructor
+  /** When called without arguments, the default constructor creates
+      a blank list head with no problem data.  Otherwise, it copies the
+      names and sets the flux scale factor. */
+  Scenario(int setScenNum=SCENARIO_HEAD, const char* name=NULL,
+	   const char* sched=NULL, double scale=1.0);
+
+  /// The destructor closes the dump file and destroys the whole list
+  /// by deleting 'next'.
+  ~Scenario();
+
+  /// This function reads a single scenario from the input file
+  /// attached to the passed stream reference and returns a pointer to
+  /// the new tail of the list.
+  Scenario* getScenario(istream&);
+
+  /// This function checks that the schedule of each scenario is
+  /// defined as a top level schedule in the list passed in the
+  /// argument.
+  void xCheck(Schedule*);
+
+  /// This function makes the compiled top schedule and opens the dump
+  /// file of each scenario, and makes this list the active sweep.
+  void makeSchedules(Schedule*);
+
+  /// Inline function making the dump file of this scenario the binary
+  /// dump file of class Result, and returning the previous one.
+  FILE* useDump()
+    { return Result::useDump(dump); };
+
+  /// This function reads the dump of this scenario for all the roots
+  /// of the list given in the argument.
+  void readDump(Root*);
+
+  /// Inline function providing access to the first scenario of the
+  /// sweep, or NULL if there is none.
+  static Scenario* getSweep()
+    { return sweep; };
+
+  /// Inline function providing access to the number of scenarios.
+  static int getNumScenarios()
+    { return nScenarios; };
+
+  /// Inline function providing access to the number of this scenario.
+  int getNum()
+    { return scenNum; };
+
+  /// Inline function providing access to the name of this scenario.
+  char* getName()
+    { return scenName; };
+
+  /// Inline function providing access to the flux scale factor.
+  double getFluxScale()
+    { return fluxScale; };
+
+  /// Inline function providing access to the top schedule.
+  topSchedule* getTop()
+    { return top; };
+
+  /// Inline function providing the ability to advance through the list
+  /// by returning 'next'.
+  Scenario* advance()
+    { return next; };
+};
+
+#endif
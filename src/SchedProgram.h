@@ -0,0 +1,145 @@
+/* $Id$ */
+#include "alara.h"
+#include <vector>
+#include <map>
+
+#ifndef SCHEDPROGRAM_H
+#define SCHEDPROGRAM_H
+
+#include "Matrix.h"
+
+/* operation types */
+#define SCHEDOP_FILL  0
+#define SCHEDOP_MULT  1
+#define SCHEDOP_MULTD 2
+#define SCHEDOP_DMULT 3
+#define SCHEDOP_COPY  4
+#define SCHEDOP_COOL  5
+
+/* special destinations in the storage of a topScheduleT; -1 is used
+ * to request a new slot */
+#define SCHEDSLOT_TOTAL -2
+#define SCHEDSLOT_COOL  -3
+
+/** \brief This class is a compiled, flat form of the calcSchedule
+ *         hierarchy.
+ *
+ *  Once the hierarchy has been collapsed, it is compiled into a
+ *  sequence of operations on transfer matrices, each writing one
+ *  numbered storage slot: filling the transfer matrix of a single
+ *  pulse, multiplying two slots, or multiplying a slot by one of the
+ *  decay matrices stored in the calcSchedule and PulseHistory objects.
+ *  Each calcSchedule is compiled only once, so that a sub-schedule
+ *  referenced from many places in the hierarchy is solved once per
+ *  interval, and the powers of the pulsing histories are expanded
+ *  into products of squares.
+ *
+ *  Every operation uses the Chain functions which only calculate the
+ *  rows that are new since the last chain, and every slot has its own
+ *  storage (in a topScheduleT object for each interval), so that the
+ *  rows calculated for the previous chain are always valid.
+ */
+
+class SchedProgram
+{
+protected:
+  /// A single operation of the program.
+  struct Op
+  {
+    /// The type of operation, SCHEDOP_*.
+    int type;
+
+    /// The slot written by this operation.
+    int dst;
+
+    /// The slots of the operands.
+    int a, b;
+
+    /// The decay matrix of SCHEDOP_MULTD and SCHEDOP_DMULT operations,
+    /// or the array of SCHEDOP_COOL, whose length is in 'b'.
+    Matrix *D;
+
+    /// The irradiation time and flux of SCHEDOP_FILL operations.
+    double opTime;
+    int fluxCode;
+  };
+
+  /// The sequence of operations.
+  std::vector<Op> ops;
+
+  /// The number of storage slots used by the operations.
+  int nSlots;
+
+  /// The slot holding the total transfer matrix of each calcSchedule
+  /// already compiled.
+  std::map<calcSchedule*,int> compiled;
+
+  /// This function appends an operation and returns its destination
+  /// slot, allocating a new slot if the destination is not given.
+  int add(int,int,int,int,Matrix*,double=0,int=0);
+
+public:
+  /// Default constructor creates an empty program.
+  SchedProgram()
+    { nSlots = 0; };
+
+  /// This function appends the filling of a single pulse transfer
+  /// matrix for the irradiation time and flux given in the arguments,
+  /// returning the new slot.
+  int fill(double opTime, int fluxCode)
+    { return add(SCHEDOP_FILL,-1,-1,-1,NULL,opTime,fluxCode); };
+
+  /// This function appends the product of the two slots given in the
+  /// arguments, in that order, returning the new slot.
+  int mult(int a, int b)
+    { return add(SCHEDOP_MULT,-1,a,b,NULL); };
+
+  /// This function appends the product of the slot given in the first
+  /// argument and the decay matrix given in the second argument,
+  /// returning the new slot.
+  int multD(int a, Matrix *D)
+    { return add(SCHEDOP_MULTD,-1,a,-1,D); };
+
+  /// This function appends the product of the decay matrix given in
+  /// the second argument and the slot given in the third argument,
+  /// storing it in the slot given in the first argument, or a new slot
+  /// if that is negative.
+  int dMult(int dst, Matrix *D, int a)
+    { return add(SCHEDOP_DMULT,dst,a,-1,D); };
+
+  /// This function appends a copy of the slot given in the second
+  /// argument to the slot given in the first.
+  int copy(int dst, int a)
+    { return add(SCHEDOP_COPY,dst,a,-1,NULL); };
+
+  /// This function returns the slot of the total transfer matrix of
+  /// the calcSchedule given in the argument, or -1 if it has not been
+  /// compiled yet.
+  int find(calcSchedule* sched)
+    { return compiled.count(sched) ? compiled[sched] : -1; };
+
+  /// This function records the slot of the total transfer matrix of a
+  /// calcSchedule.
+  void remember(calcSchedule* sched, int slot)
+    { compiled[sched] = slot; };
+
+  /// This function appends the decay of the total transfer matrix for
+  /// all of the cooling times at once, using the array of decay
+  /// matrices and the number of cooling times given in the arguments.
+  void coolAll(Matrix *coolD, int nCool)
+    { add(SCHEDOP_COOL,SCHEDSLOT_COOL,SCHEDSLOT_TOTAL,nCool,coolD); };
+
+  /// Inline access to the number of storage slots.
+  int numSlots()
+    { return nSlots; };
+
+  /// Inline access to the number of operations.
+  int numOps()
+    { return ops.size(); };
+
+  /// This function executes the program for the chain given in the
+  /// first argument, using the storage given in the second argument.
+  void execute(Chain*, topScheduleT*);
+};
+
+#endif
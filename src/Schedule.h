@@ -5,6 +5,7 @@
 #define SCHEDULE_H
 
 #include "Input_def.h"
+#include "NameIndex.h"
 
 /** \brief This class is invoked as a linked list and describes the 
  *         various irradiation schedules used in the problem.  
@@ -39,12 +40,17 @@ protected:
   /// This boolean keeps track of whether or not the given Schedule is
   /// referenced as a sub-schedule.
   /** If it is not, it will later be assumed as the top schedule.  
-      Therefore, only one schedule should not be referenced in this way. */
+      Therefore, only one schedule should not be referenced in this
+      way, unless the others are solved as scenarios of a sweep. */
   int usedAsSub;
 
   // Pointer to the next schedule item in the list
   Schedule* next;
 
+  /// The hash index of the names of the following Schedules, built on
+  /// the first search through this object.
+  NameIndex<Schedule> *nameIdx;
+
 public:
   /// Default constructor
   Schedule(const char* name=IN_HEAD);
@@ -65,6 +71,10 @@ public:
   /// Inline interface function sets the 'usedAsSub' flag to TRUE;
   void use() {usedAsSub = TRUE;};
 
+  /// Inline function indicating whether this is a top level schedule,
+  /// i.e. one not referenced as a sub-schedule.
+  int isTop() { return !usedAsSub;};
+
   /// Cross-check that the fluxes and histories referenced in the
   /// schedule items exists.
   void xCheck(Flux*,History*);
@@ -0,0 +1,123 @@
+/* $Id$ */
+#include "alara.h"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifndef SRCWRITER_H
+#define SRCWRITER_H
+
+#define SRCWRITER_MAGIC   "ALARAR2S"
+#define SRCWRITER_VERSION 1
+
+/* size of the fixed file header in bytes */
+#define SRCWRITER_HEADER  72
+
+/* values of the isotope detail flag */
+#define SRCWRITER_TOTAL    0
+#define SRCWRITER_ISOTOPES 1
+
+/** \brief This class writes a binary photon source file intended to be
+ *         memory-mapped by a transport code for rigorous two-step
+ *         (R2S) shutdown dose calculations.
+ *
+ *  The file consists of a fixed header, the photon group boundaries,
+ *  the cooling times, a dense array of the total photon source with
+ *  dimensions [entity][cooling time][group], and an optional sparse
+ *  block of per-isotope sources.  All sections are 8-byte aligned and
+ *  the dense array has a fixed location, so each entity's block is
+ *  written at its final offset as soon as it is computed.  The writes
+ *  are performed by a background thread so that they overlap with the
+ *  rest of the post-processing.
+ */
+class SrcWriter
+{
+protected:
+  /// A block of data waiting to be written at a given file offset.
+  /** If 'add' is set, the data are added to the current contents of
+      the file rather than replacing them. */
+  struct Block
+  {
+    long offset;
+    int add;
+    std::vector<double> data;
+  };
+
+  /// The file descriptor of the binary source file.
+  int fd;
+
+  /// Dimensions of the dense array.
+  int nEntities, nResults, nGroups;
+
+  /// The resolution (OUTRES_*) of the entities.
+  int resolution;
+
+  /// Flag indicating whether per-isotope records are written.
+  int isoDetail;
+
+  /// The offsets of the group boundaries, the cooling times, the dense
+  /// array and the sparse isotope block.
+  long boundsOffset, timesOffset, srcOffset, isoOffset;
+
+  /// The offset at which the next isotope record will be written.
+  long nextIsoOffset;
+
+  /// The number of isotope records written so far.
+  long nIsoRecords;
+
+  /// The queue of pending blocks shared with the writer thread.
+  std::deque<Block*> queue;
+  std::mutex queueLock;
+  std::condition_variable queueCond;
+  int done;
+
+  /// The background writer thread.
+  std::thread writer;
+
+  /// The body of the writer thread.
+  void writeLoop();
+
+  /// This function queues a block for the writer thread.
+  void push(Block*);
+
+  /// This function writes a buffer at an offset, or exits with an
+  /// error.
+  void writeAt(const void*,size_t,long);
+
+  /// This function writes the fixed file header.
+  void writeHeader();
+
+public:
+  /// This constructor creates the file named by the first argument and
+  /// sizes it for the number of entities, results and groups given by
+  /// the next three arguments.  The last arguments are the group
+  /// boundaries, the cooling times in seconds, the resolution and the
+  /// isotope detail flag.
+  SrcWriter(const char*,int,int,int,double*,double*,int,int);
+
+  /// The destructor finishes the file by calling close().
+  ~SrcWriter();
+
+  /// This function queues the [cooling time][group] source of the
+  /// 1-based entity given in the first argument.  The source is added
+  /// to what is already stored for that entity, so that the
+  /// contributions of all targets of a reverse calculation are summed.
+  void writeTotal(int,double*);
+
+  /// This function queues a per-isotope record: the entity, the kza
+  /// and its [cooling time][group] source, if isotope detail was
+  /// requested.
+  void writeIsotope(int,int,double*);
+
+  /// This function flushes the queue, stops the writer thread and
+  /// completes the header.
+  void close();
+
+  /// Inline function indicating whether per-isotope records are kept.
+  int isotopes()
+    { return isoDetail; };
+};
+
+#endif
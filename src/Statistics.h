@@ -4,12 +4,12 @@
 /* ******* Class Description ************
 
  *** Static Members ***
- treeFile : ofstream
-    This file is used to record the tree information created during
+ treeFile : TreeWriter*
+    This writer is used to record the tree information created during
     the chain building process.
 
- binFile : FILE*
-    This is a pointer to the file that will used to record the tree 
+ binFile : TreeWriter*
+    This is a pointer to the writer that will used to record the tree 
     information created during the chain building process in a binary form.
 
  tree : int 
@@ -64,16 +64,17 @@
     the value of maxRootRank upon entry.
 
  void initTree(char*)
-    This function simply opens the 'treeFile' ofstream with the
+    This function simply opens the 'treeFile' writer with the
     filename given in the first argument.
 
  void closeTree()
-    This function simply closes the 'treeFile' ofstream.
+    This function finishes and closes the 'treeFile' and 'binFile'
+    writers.
 
 
- FILE* openBinFile(fname*)
-    This function opens the binaray file specified by fname using the file
-    pinter binFile
+ TreeWriter* openBinFile(fname*)
+    This function opens the binaray file specified by fname using the
+    writer binFile
 
 
  void cpuTime(float&,float&)
@@ -84,6 +85,14 @@
  int numNodes()
     This inline function provides access to the current value of
     nodeCtr.
+ int numChains()
+    This inline function provides access to the current value of
+    chainCtr.
+ void accountWorker(int,int,int)
+    This inline function adds the numbers of nodes and chains, and
+    the maximum rank, of a subtree solved by a worker process.
+ int treeRequested()
+    This inline function provides access to the 'tree' flag.
 
  int maxRank()
     This inline function provides access to the current value of
@@ -103,14 +112,16 @@ class Statistics
 {
 protected:
 
-  /// This file is used to record the tree information created during
+  /// This writer is used to record the tree information created during
   /// the chain building process.
-  static ofstream treeFile;
+  static TreeWriter* treeFile;
 
-  /// This is a pointer to the file that will used to record the tree 
+  /// This is a pointer to the writer that will used to record the tree 
   /// information created during the chain building process in a binary 
   /// form.
-  static FILE* binFile;
+  /** Each node is a fixed 16 byte record, so that the record of node
+      number n is found at offset 16(n-1). */
+  static TreeWriter* binFile;
 
   /// This flag indicates whether or not a tree file has been requested
   /// for this run.
@@ -169,19 +180,25 @@ public:
     return tmp;
   };
 
+  /// This inline function resets the counters of nodes and chains
+  /// and the maximum ranks, at the start of the solution of a problem.
+  static void reset()
+    { nodeCtr = 0; chainCtr = 0; maxRootRank = 0; maxProblemRank = 0; };
+
   /// This function simply returns the value of NodeCtr
   static int getNodeCtr() {return nodeCtr;};
 
-  /// This function simply opens the 'treeFile' ofstream with the
+  /// This function simply opens the 'treeFile' writer with the
   /// filename given in the first argument.
   static void initTree(char*);
 
-  /// This function simply closes the 'treeFile' ofstream.
+  /// This function finishes and closes the 'treeFile' and 'binFile'
+  /// writers.
   static void closeTree();
 
   /// This function opens the binaray file specified by fname using the 
-  /// file pinter binFile
-  static FILE* openBinFile(char *);
+  /// writer binFile
+  static TreeWriter* openBinFile(char *);
 
   /// This function finds the current runtime from a system call
   static void cputime(float&,float&);
@@ -191,6 +208,22 @@ public:
   static int numNodes()
     {return nodeCtr;};
 
+  /// This inline function provides access to the current value of
+  /// chainCtr.
+  static int numChains()
+    {return chainCtr;};
+
+  /// This inline function adds the numbers of nodes and chains, and
+  /// the maximum rank, of a subtree solved by a worker process.
+  static void accountWorker(int nodes, int chains, int rank)
+    { nodeCtr+=nodes; chainCtr+=chains; 
+      maxRootRank=std::max(maxRootRank,rank); };
+
+  /// This inline function indicates whether a tree file has been
+  /// requested.
+  static int treeRequested()
+    {return tree;};
+
   /// This inline function provides access to the current value of
   /// maxProblemRank.
   static int maxRank()
@@ -58,6 +58,14 @@ public:
 
   /// Inline function returns pointer to next isotope in chain
   Node* getNext() { return next; };
+
+  /// Inline function provides access to the truncation state without
+  /// changing it.
+  int getState() { return state; };
+
+  /// This function returns this isotope to its initial truncation
+  /// state, so that the tree below it can be built again.
+  void restart();
 };
 
 #endif
@@ -0,0 +1,87 @@
+/* $Id$ */
+#include "alara.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifndef TREEWRITER_H
+#define TREEWRITER_H
+
+/* size of each of the two buffers in bytes */
+#define TREEWRITER_BUFSIZE (4<<20)
+
+/** \brief This class is a double-buffered file writer used for the
+ *         text and binary tree files.
+ *
+ *  The records of each node are appended to a large buffer in memory.
+ *  When it is full, it is swapped with a second buffer and handed to a
+ *  background thread, so that the tree building only waits for the
+ *  disk if it produces nodes faster than they can be written.
+ */
+class TreeWriter
+{
+protected:
+  /// The file descriptor of the output file.
+  int fd;
+
+  /// The buffer being filled and the buffer being written.
+  std::vector<char> fillBuf, writeBuf;
+
+  /// The number of bytes used in the buffer being filled.
+  size_t fillLen;
+
+  /// The number of bytes to be written from 'writeBuf', or 0 if the
+  /// writer thread is idle.
+  size_t writeLen;
+
+  /// The error number used if the file cannot be written.
+  int errNum;
+
+  /// Synchronization shared with the writer thread.
+  std::mutex bufLock;
+  std::condition_variable bufCond;
+  int done;
+
+  /// The background writer thread.
+  std::thread writer;
+
+  /// The body of the writer thread.
+  void writeLoop();
+
+  /// This function hands the buffer being filled to the writer thread,
+  /// waiting for the previous buffer to be written first.
+  void swap();
+
+public:
+  /// This constructor creates the file named by the first argument and
+  /// starts the writer thread.  The second argument is the error
+  /// number used for failures.
+  TreeWriter(const char*,int);
+
+  /// The destructor finishes the file by calling close().
+  ~TreeWriter();
+
+  /// This function appends the bytes given in the arguments.
+  void write(const void* data, size_t len)
+    {
+      if (fillLen + len > fillBuf.size())
+	swap();
+      memcpy(&fillBuf[fillLen],data,len);
+      fillLen += len;
+    };
+
+  /// This function appends a string.
+  void write(const char* str)
+    { write(str,strlen(str)); };
+
+  /// This function writes the remaining data, stops the writer thread
+  /// and closes the file.
+  void close();
+
+  /// Inline function indicating whether the file is open.
+  int isOpen()
+    { return (fd >= 0); };
+};
+
+#endif
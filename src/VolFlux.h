@@ -36,6 +36,10 @@ protected:
   /// Number of charged particle energy groups
   static int nCPEG;
 
+  /// The numbers of group-wise products computed by fold(), and of
+  /// those skipped outside the non-zero group range of the rates.
+  static double foldedGroups, skippedGroups;
+
   /// Neutron flux storage
   double *nflux;
     
@@ -99,6 +103,24 @@ public:
   static int getRefFluxType()
     { return refflux_type; } ;
 
+  /// Inline function provides access to the number of group-wise
+  /// products computed by fold().
+  static double getFoldedGroups()
+    { return foldedGroups; };
+
+  /// Inline function provides access to the number of group-wise
+  /// products skipped by fold().
+  static double getSkippedGroups()
+    { return skippedGroups; };
+
+  /// Inline function adds the fold counts of a worker process.
+  static void accountFolds(double folded, double skipped)
+    { foldedGroups += folded; skippedGroups += skipped; };
+
+  /// Inline function resets the fold counts.
+  static void resetFolds()
+    { foldedGroups = 0; skippedGroups = 0; };
+
   /// Default Constructor
   VolFlux();
 
@@ -118,7 +140,7 @@ public:
   /** Deletes storage for 'flux' and destroys list of VolFlux objects by
       deleting 'next'. Also deletes CPflux*/
   ~VolFlux()
-    { delete[] nflux; delete next; delete[] CPflux;};
+    { delete[] nflux; delete next; delete[] CPflux; delete[] CPfluxStorage;};
 
   /// Overloaded assignment operator
   VolFlux& operator=(const VolFlux&);
@@ -140,8 +162,21 @@ public:
   void scale(double);
   
   /// This function takes a rate vector pointed to by the first argument
-  /// and folds it with this flux, returning the scalar reaction rate.
-  double fold(double*,Node*);
+  /// and folds it with this flux over its range of non-zero groups,
+  /// returning the scalar reaction rate.
+  double fold(RateType*,Node*);
+
+  /// This function folds the block of charged particle production
+  /// cross sections pointed to by the first argument (see
+  /// Node::getCPXS()) with this flux in a single pass over the
+  /// groups, returning the production rate of each light ion in the
+  /// second argument.
+  void foldCP(const double*,double*);
+
+  /// This function folds the nCP x nCPEG charged particle reaction
+  /// cross sections pointed to by the argument with the charged
+  /// particle flux, returning the effective reaction rate.
+  double foldCPflux(const double*);
 
   /// Inline function provides access to the 'next' object in the list.
   VolFlux* advance() {return next;};
@@ -7,6 +7,9 @@
 /* fineMP volume head */
 #define VOL_HEAD -1
 
+/* maximum number of passes refining the reference flux clusters */
+#define REFGROUP_MAXITER 20
+
 #include "Result.h"
 
 /** \brief This class is invoked as a linked list and describes the 
@@ -67,6 +70,14 @@ protected:
       the different transfer matrices. */
   topScheduleT* schedT;
 
+  /// The storage matrix containers of the scenarios of a sweep, one
+  /// per scenario, or NULL if there is no sweep.
+  topScheduleT** scenSchedT;
+
+  /// The lists of results of the scenarios of a sweep, one per
+  /// scenario, or NULL if there is no sweep.
+  Result* scenResults;
+
   /// A linked list of results.
   /** Each Result item in the list points to a linked list of results 
       for a particular root isotope.  There is one Result item in the
@@ -85,10 +96,23 @@ protected:
   double *total;
 
   /// Gamma source to dose conversion factor (adjoint calculation)
+  /** This points to this interval's row of the dense adjoint field
+      array owned by the adjoint dose GammaSrc. */
   double *adjConv;
 
-  /// cache the isotopic specific dose contribution from this volume
-  DataCache doseContrib;
+  /// The index of this interval in the dense isotope x interval
+  /// adjoint dose table of the GammaSrc.
+  int adjIdx;
+
+  /// The cluster of intervals whose reference flux is used for the
+  /// truncation of the chains solved in this interval.
+  /** In a reference interval, this is the cluster whose intervals
+      make up its flux.  (see clusterRefFlux()) */
+  int refGroup;
+
+  /// The number of clusters of intervals, each with its own reference
+  /// flux.
+  static int nRefGroups;
  
   /// A pointer to the next Volume object in the problem-wide list.
   /** This pointer represents the next Volume in the sequence
@@ -123,6 +147,10 @@ protected:
   /// operator to delete the storage for 'zoneName', delete the
   /// 'flux' and 'results' lists, and delete the 'schedT' storage.
   void deinit();
+
+  /// This function initializes the storage space hierarchies and
+  /// result lists for the scenarios of a sweep.
+  void makeScenarioTs();
   
 public:
   /// Default constructor
@@ -135,8 +163,10 @@ public:
   /// Copy constructor
   Volume(const Volume&);
 
-  // NEED COMMENT
-  Volume(Root*,topSchedule*);
+  /// This constructor creates the reference interval of the root
+  /// isotope given in the first argument, from the intervals of the
+  /// cluster given in the third argument.
+  Volume(Root*,topSchedule*,int);
 
   /// This destructor calls deinit(), and then destroys the whole list
   /// by deleting 'next'.
@@ -179,6 +209,10 @@ public:
   /// matrices.  
   void makeSchedTs(topSchedule*);
 
+  /// This function divides the intervals of the problem-wide list into
+  /// nRefGroups clusters by the magnitude and shape of their flux.
+  void clusterRefFlux();
+
   /// This is the master routine for the creation of the reference flux.
   void refFlux(Volume*);
 
@@ -186,15 +220,35 @@ public:
   /// master schedule.
   void solve(Chain*, topSchedule*);
 
+  /// This is the master routine for the solution of the chain on the
+  /// schedule and fluxes of a scenario of a sweep.
+  void solve(Chain*, Scenario*);
+
   /// This is identical to solve(...) but does not perform the tallying.
   topScheduleT* solveRef(Chain*, topSchedule*);
 
+  /// This is identical to solve(...) for a scenario but does not
+  /// perform the tallying.
+  topScheduleT* solveRef(Chain*, Scenario*);
+
   /// This short function supports the creation of the dump file.
   void writeDump();
 
+  /// This short function supports the creation of the dump file of a
+  /// scenario.
+  void writeDump(Scenario*);
+
   /// This short function supports the reading of the dump file.
   void readDump(int);
 
+  /// This function writes the results of the current root isotope, for
+  /// the main problem and each scenario, to the file given in the
+  /// argument for each interval in the mixture's list.
+  void writeTally(FILE*);
+
+  /// This function tallies the results written by writeTally(...).
+  void readTally(FILE*);
+
   /// This is the front-end to the function that tallies the results for
   /// each root isotope into lists of results for each component and a 
   /// total list of results.
@@ -202,13 +256,28 @@ public:
 
   /// This function is responsible for writing the results to standard
   /// output.  
-  void write(int, int, CoolingTime*,int,int);
+  void write(int, int, CoolingTime*,int);
 
   /// Inline function to determine whether this object is the head of
   /// the list.
   /** Creates boolean by comparing 'volume' to VOL_HEAD. */
   int head() {return (volume == VOL_HEAD && next == NULL);};
 
+  /// This function determines whether any flux has been collected in
+  /// this reference interval.
+  int hasFlux();
+
+  /// Inline function provides access to the reference flux cluster.
+  int getRefGroup() { return refGroup; };
+
+  /// Inline function sets the number of reference flux clusters.
+  static void setNumRefGroups(int numGroups)
+    { nRefGroups = numGroups; };
+
+  /// Inline function queries the number of reference flux clusters.
+  static int getNumRefGroups()
+    { return nRefGroups; };
+
   /// This function is used for reverse calculations to clear the values
   /// of the outputList 
   void resetOutList();
@@ -229,9 +298,23 @@ public:
   /// Loads the charged particle ranges into rangeLib
   static void loadRangeLib(istream *probInput);
 
-  void readAdjDoseData(int, ifstream&);
-  /// This function reads adjoint field data from input file.
+  /// This function reads adjoint field data from input file into the
+  /// dense array given in the third argument, one row per interval,
+  /// and the interval volumes into the fourth argument.
+  void readAdjDoseData(int, ifstream&, double*, double*);
+
+  /// This function adds the kza of every isotope in the output lists of
+  /// all intervals to the set given in the argument.
+  void getIsoList(std::set<int>&);
+
+  /// This function fills the arguments with the kza and the total
+  /// results of every isotope of each interval, leaving them empty for
+  /// void intervals.
+  void getTotals(std::vector<std::vector<int> >&,
+		 std::vector<std::vector<double> >&);
 
+  /// This function returns the adjoint dose conversion of an isotope in
+  /// this interval from the table of the GammaSrc.
   double getAdjDoseConv(int, GammaSrc*);
   
   inline double getUserVol() { return userVol; }
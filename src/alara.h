@@ -31,6 +31,21 @@ typedef std::map<int,double,std::less<int> > DataCache;
 typedef std::map<int,double*,std::less<int> > VectorCache;
 typedef std::map<int, double*, std::less<int> > TempLibType;
 
+/* *** Rate vector typedef ***
+
+ RateType : float or double
+   The element type of the group-wise rate vectors of the chains.  The
+   library data is single precision, so the rates may be stored as
+   float (configure --enable-float-rates) to halve the memory traffic of
+   folding them with the fluxes, which is always summed in double.
+ */
+
+#ifdef FLOAT_RATES
+typedef float RateType;
+#else
+typedef double RateType;
+#endif
+
 /* import std::istream, std::ofstream since alternative implmentations
  * are unlikely */
 using std::istream;
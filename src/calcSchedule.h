@@ -145,15 +145,14 @@ public:
   /// the storage matrices 'D'.
   void setDecay(Chain*);
 
-  /// This function manages the solution of the chain passed in argument
-  /// 1 on the schedule hierarchy using the storage transfer matrix
-  /// hierarchy passed in second argument.
-  void setT(Chain*, calcScheduleT*);
-
-  /// In this fucntion each subschedule is solved recursively with
-  /// master transfer matrix, 'calcScheduleT::opBlockT' being built by
-  /// multiplication.
-  void setSubTs(Chain*, calcScheduleT*);
+  /// This function appends the operations which solve this schedule
+  /// to the program given in the argument, unless they are already
+  /// there, and returns the slot of the total transfer matrix.
+  int compile(SchedProgram&);
+
+  /// This function appends the operations which build the operation
+  /// transfer matrix from the sub-schedules, and returns its slot.
+  int compileSubs(SchedProgram&);
 
   /// Inline function provides access to number of items in this schedule.
   int numItems() { return nItems; };
@@ -11,6 +11,7 @@ class Loading;
 class Mixture;
 class Norm;
 class PulseLevel;
+class Scenario;
 class Schedule;
 class ScheduleItem;
 class Volume;
@@ -35,6 +36,7 @@ class calcSchedule;
 class calcScheduleT;
 class topSchedule;
 class topScheduleT;
+class SchedProgram;
 
 /* Output */
 class DoseResponse;
@@ -42,6 +44,8 @@ class OutputFormat;
 class Result;
 class ResultList;
 class GammaSrc;
+class SrcWriter;
+class TreeWriter;
 
 /* DataLib */
 class DataLib;
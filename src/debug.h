@@ -5,3 +5,12 @@ void error(int, const char*, ...);
 void warning(int, const char*, ...);
 
 void memCheck(void*, const char*);
+
+/* while errors are caught by the process (see Problem::solve()), error()
+   throws this instead of exiting */
+struct alaraError
+{
+  int num;
+  std::string msg;
+};
+void catchErrors(int);
@@ -1,6 +1,8 @@
 /* $Id: functions.h,v 1.8 2003-10-28 22:11:39 wilsonp Exp $ */
 /* input.C */
 istream* openFile(const char*);
+void setMemFile(const char*, const std::string&);
+void clearMemFile(const char*);
 void clearComment(istream& input);
 int tokenType(char*);
 double convertTime(double,char);
@@ -27,5 +27,8 @@ extern const char *tokenList;
 #define INTOK_IGNORE     23
 #define INTOK_REFFLUX    24
 #define INTOK_CPLIBS     25
+#define INTOK_BINOUT     26
+#define INTOK_SCENARIO   27
+#define INTOK_REFGROUPS  28
 
 
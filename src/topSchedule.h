@@ -29,6 +29,9 @@ protected:
   /// after-shutdown cooling times.
   Matrix *coolD;
 
+  /// The compiled form of the whole schedule hierarchy.
+  SchedProgram *program;
+
 public:
   /// Inline constructor invokes base class copy constructor and
   /// initializes 'coolD' to NULL.
@@ -44,11 +47,21 @@ public:
   /// Overloaded assignment operator
   topSchedule& operator=(const topSchedule&);
 
+  /// This function compiles the collapsed schedule hierarchy into
+  /// 'program'.
+  void compile();
+
+  /// This function returns the number of storage slots needed by each
+  /// topScheduleT object.
+  int numSlots();
+
   /// This function serves a similar purpose to
   /// calcSchedule::setDecay(...).
   void setDecay(Chain*);
 
-  /// This function serves a similar purpose to calcSchedule::setT(...).
+  /// This function manages the solution of the chain passed in
+  /// argument 1 by executing the compiled schedule with the storage
+  /// passed in the second argument.
   void setT(Chain*, topScheduleT*);
 };
 
@@ -6,6 +6,7 @@
 
 #include "calcScheduleT.h"
 #include "Matrix.h"
+#include "SchedProgram.h"
 
 /** \brief This class is the head of a linked hierarchy of storage for
  *         the transfer matrices throughout the schedule.
@@ -26,6 +27,13 @@ protected:
   /// following the after-shutdown cooling times.
   Matrix *coolT;
 
+  /// The number of storage slots of the compiled schedule.
+  int nSlots;
+
+  /// An array of Matrices for storing the intermediate results of the
+  /// compiled schedule, one per slot.
+  Matrix *slotT;
+
 public:
   /// Inline function providing access to set static member
   /// 'nCoolingTimes'.
@@ -44,6 +52,10 @@ public:
   /// Copy Constructor
   topScheduleT(const topScheduleT&);
    
+  /// Destructor deletes the storage for 'coolT' and 'slotT'.
+  ~topScheduleT()
+    { delete [] coolT; delete [] slotT; };
+
   /// Overlaoded assignment operator
   topScheduleT& operator=(const topScheduleT&);
 
@@ -58,6 +70,14 @@ public:
   /** With this function, we can avoid having friend classes and
       functions. */
   Matrix& cool(int idx) { return coolT[idx]; };
+
+  /// This function returns a reference to the storage of the compiled
+  /// schedule slot indicated by the argument, where the special slots
+  /// SCHEDSLOT_TOTAL and SCHEDSLOT_COOL-n refer to 'totalT' and
+  /// 'coolT[n]'.
+  Matrix& slot(int idx)
+    { return (idx >= 0) ? slotT[idx] :
+	(idx == SCHEDSLOT_TOTAL) ? totalT : coolT[SCHEDSLOT_COOL-idx]; };
 };
 
 #endif
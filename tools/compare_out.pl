@@ -0,0 +1,111 @@
+#!/usr/bin/perl
+# $Id$
+
+# Tool to compare the results tables of the ALARA output files in an
+# output directory with those of the same name in a reference
+# directory (e.g. sample/ref_out), and report the largest relative
+# difference in each file and the number of values that differ by
+# more than a tolerance.
+#
+# usage: compare_out.pl [-t <tolerance>] <reference_dir> <output_dir>
+#
+# Each value is identified by its response, zone/interval/mixture,
+# constituent and isotope, so that isotopes which appear in only one
+# of the files (e.g. through a different truncation) are counted
+# separately rather than shifting the comparison.
+
+$tol = 1e-4;
+if ($ARGV[0] eq "-t") {
+    shift;
+    $tol = shift;
+}
+
+if (@ARGV != 2) {
+    die "usage: $0 [-t <tolerance>] <reference_dir> <output_dir>\n";
+}
+
+($refDir, $outDir) = @ARGV;
+
+# read the results of one output file into a hash of rows of values
+sub readResults
+{
+    my $fname = shift;
+    my %rows;
+    my %count;
+    my ($response, $region, $constituent) = ("", "", "");
+
+    open(OUT, $fname) || die "Unable to open $fname\n";
+    while (<OUT>) {
+	if (/^\*\*\* (.*) \*\*\*/) {
+	    $response = $1;
+	    ($region, $constituent) = ("", "");
+	} elsif (/^(Zone|Interval|Mixture|Material) #/) {
+	    chomp($region = $_);
+	    $constituent = "";
+	} elsif (/^Constituent: (\S+)/) {
+	    $constituent = $1;
+	} elsif (/^(\S+)\s+((?:[-+]?\d\.\d+e[-+]\d+\s*)+)$/i) {
+	    my $key = "$response|$region|$constituent|$1";
+	    $key .= "#" . $count{$key}++;
+	    $rows{$key} = [ split(' ', $2) ];
+	}
+    }
+    close(OUT);
+
+    return %rows;
+}
+
+$allValues = 0;
+$allOver = 0;
+$allMax = 0;
+
+opendir(REF, $refDir) || die "Unable to open $refDir\n";
+@files = sort grep(/\.out$/, readdir(REF));
+closedir(REF);
+
+printf("%-16s %8s %12s %8s %8s\n", "file", "values", "max rel diff",
+       "> tol", "unpaired");
+
+foreach $file (@files) {
+    if (! -e "$outDir/$file") {
+	printf("%-16s missing\n", $file);
+	next;
+    }
+
+    %ref = readResults("$refDir/$file");
+    %out = readResults("$outDir/$file");
+
+    $values = 0;
+    $over = 0;
+    $max = 0;
+    $unpaired = 0;
+
+    foreach $key (keys %ref) {
+	if (!exists $out{$key}) {
+	    $unpaired++;
+	    next;
+	}
+	@a = @{$ref{$key}};
+	@b = @{$out{$key}};
+	for ($idx = 0; $idx < @a && $idx < @b; $idx++) {
+	    $scale = abs($a[$idx]) > abs($b[$idx]) ? abs($a[$idx]) : abs($b[$idx]);
+	    $diff = $scale > 0 ? abs($a[$idx] - $b[$idx])/$scale : 0;
+	    $max = $diff if ($diff > $max);
+	    $over++ if ($diff > $tol);
+	    $values++;
+	}
+    }
+    foreach $key (keys %out) {
+	$unpaired++ if (!exists $ref{$key});
+    }
+
+    printf("%-16s %8d %12.4e %8d %8d\n", $file, $values, $max, $over,
+	   $unpaired);
+
+    $allValues += $values;
+    $allOver += $over;
+    $allMax = $max if ($max > $allMax);
+}
+
+printf("%-16s %8d %12.4e %8d\n", "all", $allValues, $allMax, $allOver);
+printf("tolerance: %g\n", $tol);